@@ -0,0 +1,115 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Fixed-capacity table for requests that wait for an answer from the gateway.
+//
+// Ids are built from the slot index (low 32 bits) and a per-slot generation (high 32 bits), so
+// lookup and erase are O(1) and an id of an already answered or expired request never matches a
+// newer entry in the same slot. Free slots are found by linear probing from a moving cursor.
+// The generation starts at 1, therefore 0 is never a valid id.
+template <typename T>
+class CorrelationTable {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CorrelationTable(size_t capacity) : mSlots(capacity), mCursor{0}, mSize{0} { }
+
+    // Stores value until deadline. Returns its id or 0 if the table is full.
+    uint64_t insert(T value, Clock::time_point deadline) {
+        std::lock_guard<std::mutex> lck{mMutex};
+
+        const size_t capacity = mSlots.size();
+        if (mSize == capacity) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < capacity; i++) {
+            const size_t index = (mCursor + i) % capacity;
+            Slot& slot = mSlots[index];
+            if (!slot.used) {
+                slot.used = true;
+                slot.generation = (slot.generation == UINT32_MAX) ? 1 : slot.generation + 1;
+                slot.deadline = deadline;
+                slot.value = std::move(value);
+
+                mCursor = (index + 1) % capacity;
+                mSize++;
+                return (static_cast<uint64_t>(slot.generation) << 32) | index;
+            }
+        }
+        return 0;
+    }
+
+    // Removes the entry with the given id and hands out its value. Returns false if the id is
+    // unknown, e.g. because the request was already answered or has expired.
+    bool take(uint64_t id, T& value) {
+        const size_t index = static_cast<size_t>(id & UINT32_MAX);
+        const uint32_t generation = static_cast<uint32_t>(id >> 32);
+
+        std::lock_guard<std::mutex> lck{mMutex};
+        if (index >= mSlots.size()) {
+            return false;
+        }
+
+        Slot& slot = mSlots[index];
+        if (!slot.used || slot.generation != generation) {
+            return false;
+        }
+
+        value = std::move(slot.value);
+        slot.value = T{};
+        slot.used = false;
+        mSize--;
+        return true;
+    }
+
+    // Removes all entries whose deadline has passed and calls onExpired(T&&) for each of them,
+    // outside of the table lock. Returns the number of expired entries.
+    template <typename Fn>
+    size_t expire(Clock::time_point now, Fn&& onExpired) {
+        std::vector<T> expired;
+        {
+            std::lock_guard<std::mutex> lck{mMutex};
+            if (mSize == 0) {
+                return 0;
+            }
+            for (Slot& slot : mSlots) {
+                if (slot.used && slot.deadline <= now) {
+                    expired.push_back(std::move(slot.value));
+                    slot.value = T{};
+                    slot.used = false;
+                    mSize--;
+                }
+            }
+        }
+
+        for (T& value : expired) {
+            onExpired(std::move(value));
+        }
+        return expired.size();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lck{mMutex};
+        return mSize;
+    }
+
+    size_t capacity() const { return mSlots.size(); }
+
+private:
+    struct Slot {
+        bool used = false;
+        uint32_t generation = 0;
+        Clock::time_point deadline{};
+        T value{};
+    };
+
+    mutable std::mutex mMutex;
+    std::vector<Slot> mSlots;
+    size_t mCursor;
+    size_t mSize;
+};
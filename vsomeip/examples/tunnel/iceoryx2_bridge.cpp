@@ -2,42 +2,148 @@
 #include "vsomeip/constants.hpp"
 #include "vsomeip/message.hpp"
 #include "vsomeip/primitive_types.hpp"
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <cassert>
 #include <iterator>
+#include <iox2/config.hpp>
 #include <iox2/node.hpp>
+#include <iox2/node_state.hpp>
 #include <mutex>
+#include <pthread.h>
 #include <thread>
 #include <vsomeip/internal/logger.hpp>
-constexpr iox::units::Duration CYCLE_TIME = iox::units::Duration::fromMilliseconds(100);
+
+namespace {
+// Control messages the gateway cannot take are retried after 1, 2, 4 and 8 ms, by the receive
+// thread of lane 0 and therefore at the earliest at its next wake-up (see retryControl())
+constexpr size_t CONTROL_PUBLISH_ATTEMPTS = 5;
+constexpr std::chrono::milliseconds CONTROL_RETRY_BACKOFF{1};
+
+void pinToCpu(std::thread& thread, int cpu) {
+#if defined(__linux__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus) != 0) {
+        VSOMEIP_WARNING << "Couldn't pin tunnel receive thread to CPU " << cpu;
+    }
+#else
+    (void)thread;
+    VSOMEIP_WARNING << "Pinning tunnel receive threads is not supported, ignoring CPU " << cpu;
+#endif
+}
+
+bool isSameEvent(const vsomeip_v3::event_registration_t& a, const vsomeip_v3::event_registration_t& b) {
+    return a.event_ == b.event_ && a.eventgroups_ == b.eventgroups_ && a.type_ == b.type_ && a.reliability_ == b.reliability_;
+}
+
+// Events of current that are missing or different in wanted go to removed, events of wanted that
+// are missing or different in current go to added.
+void diffEvents(const std::vector<vsomeip_v3::event_registration_t>& current, const std::vector<vsomeip_v3::event_registration_t>& wanted,
+                std::vector<vsomeip::event_t>& removed, std::vector<vsomeip_v3::event_registration_t>& added) {
+    std::map<vsomeip::event_t, const vsomeip_v3::event_registration_t*> its_current;
+    for (const auto& event : current) {
+        its_current[event.event_] = &event;
+    }
+    for (const auto& event : wanted) {
+        auto found = its_current.find(event.event_);
+        if (found != its_current.end() && isSameEvent(*found->second, event)) {
+            its_current.erase(found);
+        } else {
+            added.push_back(event);
+        }
+    }
+    for (const auto& event : its_current) {
+        removed.push_back(event.first);
+    }
+}
+
+// Union of the events and eventgroups of the finds of several gateways. An event found with
+// different eventgroups gets all of them.
+template <typename Finds>
+void mergeFinds(const Finds& finds, std::vector<vsomeip_v3::event_registration_t>& events, std::set<vsomeip::eventgroup_t>& groups) {
+    std::map<vsomeip::event_t, vsomeip_v3::event_registration_t> its_events;
+    for (const auto& find : finds) {
+        groups.insert(find.second.groups.begin(), find.second.groups.end());
+        for (const auto& event : find.second.events) {
+            auto inserted = its_events.emplace(event.event_, event);
+            if (!inserted.second) {
+                inserted.first->second.eventgroups_.insert(event.eventgroups_.begin(), event.eventgroups_.end());
+            }
+        }
+    }
+    for (auto& event : its_events) {
+        events.push_back(std::move(event.second));
+    }
+}
+
+}
+
+std::set<uint32_t> removeDeadNodes() {
+    using Ipc = iox2::ServiceType;
+    std::set<uint32_t> removed;
+    auto result = iox2::Node<Ipc::Ipc>::list(iox2::Config::global_config(), [&removed](iox2::NodeState<Ipc::Ipc> state) {
+        state.dead([&removed](iox2::DeadNodeView<Ipc::Ipc>& view) {
+            auto is_removed = view.remove_stale_resources();
+            if (is_removed.has_value() && is_removed.value()) {
+                removed.insert(static_cast<uint32_t>(view.id().pid()));
+            }
+        });
+        return iox2::CallbackProgression::Continue;
+    });
+    if (result.has_error()) {
+        VSOMEIP_WARNING << "Couldn't list the iceoryx2 nodes to remove dead ones";
+    }
+    return removed;
+}
 
 SomeipTunnel::SomeipTunnel(std::shared_ptr<vsomeip_v3::runtime> runtime) :
-    mNode{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")}, mRecv{}, mShallRun{true}, mRtm{runtime},
-    mApp{mRtm->create_application("Tunnel")},
-    mToGateway{mNode.service_builder(iox2::ServiceName::create("TunnelToRust").expect("valid service name"))
-                       .publish_subscribe<SomeipTunnelPayload>()
-                       .user_header<SomeipTunnelHeader>()
-                       .subscriber_max_buffer_size(20)
-                       .history_size(20)
-                       .open_or_create()
-                       .expect("successful service creation/opening")
-                       .publisher_builder()
-                       .create()
-                       .expect("successful publisher creation")},
-    mFromGateway{mNode.service_builder(iox2::ServiceName::create("TunnelFromRust").expect("valid service name"))
-                         .publish_subscribe<SomeipTunnelPayload>()
-                         .user_header<SomeipTunnelHeader>()
-                         .subscriber_max_buffer_size(20)
-                         .history_size(20)
-                         .open_or_create()
-                         .expect("successful service creation/opening")
-                         .subscriber_builder()
-                         .create()
-                         .expect("successful subscriber creation")},
-    mMessagesInProgress{}, mRd{}, mGen{}, mDist{mGen()} {
-
-    mRecv = std::thread{&SomeipTunnel::recvInternal, this};
+    mConfig{}, mRtm{runtime}, mApp{mRtm->create_application("Tunnel")}, mNextStatsReport{}, mTraceMessages{false},
+    mIsControlRetryPending{false}, mNextExpiryCheck{}, mNextThrottleCleanup{}, mIsRestartPending{false} { }
+
+void SomeipTunnel::startLanes() {
+    VSOMEIP_INFO << "Tunnel wait mode: " << mConfig.wait_mode << ", cycle time: " << mConfig.cycle_time.count()
+                 << " ms, spin time: " << mConfig.spin_time.count() << " us, thread publishers: " << mConfig.max_thread_publishers
+                 << ", max requests: " << mConfig.max_requests_in_flight << ", request timeout: " << mConfig.request_timeout.count()
+                 << " ms, lanes: " << mConfig.lanes << (mConfig.lane_hash ? " (hashed)" : "") << ", control/event/request lane: "
+                 << mConfig.class_lanes[0] << "/" << mConfig.class_lanes[1] << "/" << mConfig.class_lanes[2]
+                 << ", stats interval: " << mConfig.stats_interval.count() << " ms, restart grace: " << mConfig.restart_grace.count()
+                 << " ms, field cache slots: " << mConfig.field_cache_slots
+                 << ", event throttle: " << mConfig.event_throttle.count() << " ms, topics: " << mConfig.topics.size();
+
+    mMessagesInProgress.reset(new CorrelationTable<std::shared_ptr<vsomeip_v3::message>>{mConfig.max_requests_in_flight});
+
+    if (mConfig.stats_interval.count() > 0) {
+        mStatsPublisher.reset(new TunnelStatsPublisher{});
+        mNextStatsReport = std::chrono::steady_clock::now() + mConfig.stats_interval;
+    }
+    if (mConfig.field_cache_slots > 0) {
+        mFieldCache.reset(new TunnelFieldCache{mConfig.field_cache_slots});
+    }
+    if (!mConfig.topics.empty()) {
+        mTopics.reset(new TunnelTopics{mConfig, mStats});
+    }
+
+    createLanes();
+}
+
+void SomeipTunnel::createLanes() {
+    const auto handler = [this](TunnelLane& lane, const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload) {
+        this->incommingMsg(lane, header, payload);
+    };
+    for (size_t i = 0; i < mConfig.lanes; i++) {
+        mLanes.emplace_back(new TunnelLane{i, mConfig, mStats, handler});
+    }
+
+    for (auto& lane : mLanes) {
+        mRecv.emplace_back(&SomeipTunnel::recvInternal, this, std::ref(*lane));
+        if (lane->config().cpu >= 0) {
+            pinToCpu(mRecv.back(), lane->config().cpu);
+        }
+    }
 }
 
 void on_state(vsomeip::state_type_e _state) {
@@ -54,6 +160,11 @@ void SomeipTunnel::init() {
         return;
     }
 
+    mConfig = TunnelConfig::fromEnvironment(TunnelConfig::fromApplication(*mApp));
+    // Formatting the payloads is expensive, even if the logger filters the message afterwards
+    mTraceMessages = mConfig.trace_messages;
+    startLanes();
+
     mApp->register_state_handler(&on_state);
 
     mApp->register_message_handler(vsomeip_v3::ANY_SERVICE, vsomeip_v3::ANY_INSTANCE, vsomeip_v3::ANY_METHOD,
@@ -66,57 +177,381 @@ void SomeipTunnel::init() {
 
 void SomeipTunnel::stop() {
     mApp->stop();
+    stopLanes();
+}
+
+void SomeipTunnel::stopLanes() {
+    for (auto& lane : mLanes) {
+        lane->stop();
+    }
+    for (auto& thread : mRecv) {
+        thread.join();
+    }
+    mRecv.clear();
+}
+
+bool SomeipTunnel::restartGateway(TunnelGatewayId gateway, bool isOnlyGateway) {
+    // Without a grace period, the registrations of a gateway sharing the tunnel are withdrawn at
+    // the next expiry check unless the new instance repeats them
+    if (mConfig.restart_grace.count() == 0 && isOnlyGateway) {
+        return false;
+    }
+
+    if (isOnlyGateway) {
+        stopLanes();
+    }
+
+    size_t offers = 0;
+    size_t finds = 0;
+    {
+        std::lock_guard<std::mutex> lck{mServicesMutex};
+        for (auto& offer : mOffers) {
+            if (offer.second.gateway == gateway) {
+                offer.second.is_confirmed = false;
+                offers++;
+            }
+        }
+        for (auto& find : mFinds) {
+            auto found = find.second.gateways.find(gateway);
+            if (found != find.second.gateways.end()) {
+                found->second.is_confirmed = false;
+                finds++;
+            }
+        }
+        if (offers > 0 || finds > 0) {
+            mGraceDeadlines[gateway] = std::chrono::steady_clock::now() + mConfig.restart_grace;
+            mIsRestartPending = true;
+        }
+    }
+
+    if (!isOnlyGateway) {
+        // The other gateways keep using the ports. Requests for services of the restarted gateway
+        // run into the request timeout unless the new instance answers them.
+        VSOMEIP_INFO << "Gateway " << gateway << " restarted, keeping its " << offers << " offer(s) and " << finds << " find(s) for "
+                     << mConfig.restart_grace.count() << " ms";
+        return true;
+    }
+
+    // Neither gateway will answer the requests of the old one. Answers of SOME/IP to calls of
+    // the old gateway are dropped as correlation misses.
+    std::vector<std::shared_ptr<vsomeip_v3::message>> unanswered;
+    size_t dropped_calls = 0;
+    {
+        std::unique_lock<std::shared_mutex> lck{mLanesMutex};
+        mLanes.clear();
+
+        mMessagesInProgress->expire(std::chrono::steady_clock::time_point::max(),
+                                    [&unanswered](std::shared_ptr<vsomeip_v3::message>&& request) { unanswered.push_back(std::move(request)); });
+        {
+            std::lock_guard<std::mutex> calls{mCallsMutex};
+            dropped_calls = mCalls.size();
+            mCalls.clear();
+        }
+        {
+            // Meant for the old instance of the gateway
+            std::lock_guard<std::mutex> retries{mControlRetriesMutex};
+            mControlRetries.clear();
+            mIsControlRetryPending = false;
+        }
 
-    mShallRun.store(false);
-    mRecv.join();
+        createLanes();
+    }
+
+    for (const auto& request : unanswered) {
+        sendError(request, vsomeip_v3::return_code_e::E_NOT_REACHABLE);
+    }
+
+    VSOMEIP_INFO << "Gateway " << gateway << " restarted, keeping " << offers << " offer(s) and " << finds << " find(s) for "
+                 << mConfig.restart_grace.count() << " ms, " << unanswered.size() << " request(s) answered with E_NOT_REACHABLE, "
+                 << dropped_calls << " call(s) dropped";
+    return true;
+}
+
+TunnelLane& SomeipTunnel::laneFor(TunnelTrafficClass traffic, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance) {
+    return *mLanes[mConfig.laneFor(traffic, service, instance)];
 }
 
 void SomeipTunnel::serviceStateChanged(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, bool active) {
     VSOMEIP_INFO << "Received serviceStateChanged from SOME/IP service " << s << " instance " << i << " active " << active;
 
-    std::lock_guard<std::mutex> lck{mToGatewayMutex};
-
-    auto new_sample = mToGateway.loan().expect("should have sample");
+    {
+        std::lock_guard<std::mutex> lck{mServicesMutex};
+        if (active) {
+            mAvailable.insert({s, i});
+        } else {
+            mAvailable.erase({s, i});
+        }
+    }
 
-    SomeipTunnelHeader& header = new_sample.user_header_mut();
+    sendServiceState(s, i, active);
+    VSOMEIP_INFO << "Service state changed was send via tunnel!";
+}
 
+void SomeipTunnel::sendServiceState(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, bool active) {
+    SomeipTunnelHeader header{};
     header.type = TunnelMsgType::FIND_SERVICE_ACK;
 
     header.instance_id = i;
     header.service_id = s;
-    header.is_active = active;
+    header.flags = active ? TUNNEL_FLAG_ACTIVE : 0;
 
-    ::iox2::send(std::move(new_sample)).expect("Sending sample shall work");
-    VSOMEIP_INFO << "Service state changed was send via tunnel!";
+    std::shared_lock<std::shared_mutex> lck{mLanesMutex};
+    publishControl(laneFor(TunnelTrafficClass::Control, s, i), header, nullptr, 0);
+}
+
+void SomeipTunnel::publishControl(TunnelLane& lane, const SomeipTunnelHeader& header, const uint8_t* data, size_t length) {
+    std::lock_guard<std::mutex> lck{mControlRetriesMutex};
+    // A later control message must not overtake an earlier one that waits for a retry
+    const bool is_waiting = std::any_of(mControlRetries.begin(), mControlRetries.end(),
+                                        [&lane](const ControlRetry& retry) { return retry.lane == lane.index(); });
+    if (!is_waiting && lane.toGateway().publish(header, data, length)) {
+        return;
+    }
+    // A lost availability or acknowledgement leaves the gateway in a wrong state until the next
+    // change, therefore control messages get a few more attempts while the gateway catches up
+    mControlRetries.push_back(ControlRetry{lane.index(), header, std::vector<uint8_t>(data, data + length), 1, CONTROL_RETRY_BACKOFF,
+                                           std::chrono::steady_clock::now() + CONTROL_RETRY_BACKOFF});
+    mIsControlRetryPending = true;
+}
+
+void SomeipTunnel::retryControl() {
+    if (!mIsControlRetryPending) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    std::shared_lock<std::shared_mutex> lanes{mLanesMutex};
+    std::lock_guard<std::mutex> lck{mControlRetriesMutex};
+
+    std::set<size_t> blocked; // lanes whose first waiting message is not sent yet
+    for (auto it = mControlRetries.begin(); it != mControlRetries.end();) {
+        if (blocked.count(it->lane) > 0 || it->due > now) {
+            blocked.insert(it->lane);
+            ++it;
+        } else if (mLanes[it->lane]->toGateway().publish(it->header, it->payload.data(), it->payload.size())) {
+            it = mControlRetries.erase(it);
+        } else if (++it->attempts == CONTROL_PUBLISH_ATTEMPTS) {
+            VSOMEIP_ERROR << "Couldn't send " << it->header.type << " for service " << it->header.service_id << "." << it->header.instance_id
+                          << " to the gateway on lane " << it->lane << " after " << it->attempts << " attempts";
+            it = mControlRetries.erase(it);
+        } else {
+            it->backoff *= 2;
+            it->due = now + it->backoff;
+            blocked.insert(it->lane);
+            ++it;
+        }
+    }
+    mIsControlRetryPending = !mControlRetries.empty();
+}
+
+bool SomeipTunnel::isThrottled(const TunnelPublisherPool& toGateway, const SomeipTunnelHeader& header,
+                               std::chrono::steady_clock::time_point now) {
+    if (mConfig.event_throttle.count() == 0 || !toGateway.isCongested(now)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lck{mThrottleMutex};
+    auto& next = mThrottled[eventKeyOf(header.service_id, header.instance_id, header.method_id)];
+    if (now < next) {
+        return true;
+    }
+    next = now + mConfig.event_throttle;
+    return false;
+}
+
+void SomeipTunnel::offerService(TunnelGatewayId gateway, vsomeip_v3::service_t s, vsomeip_v3::instance_t i,
+                                std::vector<vsomeip_v3::event_registration_t>&& events) {
+    std::lock_guard<std::mutex> lck{mServicesMutex};
+    auto found = mOffers.find({s, i});
+    if (found == mOffers.end()) {
+        mApp->offer_events(s, i, events);
+        mApp->offer_service(s, i);
+        mOffers[{s, i}] = ServiceRegistration{gateway, std::move(events), {}, true};
+        return;
+    }
+    if (found->second.gateway != gateway) {
+        VSOMEIP_WARNING << "Service " << s << " instance " << i << " is already offered by gateway " << found->second.gateway
+                        << ", ignoring the offer of gateway " << gateway;
+        return;
+    }
+
+    std::vector<vsomeip::event_t> removed;
+    std::vector<vsomeip_v3::event_registration_t> added;
+    diffEvents(found->second.events, events, removed, added);
+    for (auto event : removed) {
+        mApp->stop_offer_event(s, i, event);
+    }
+    mApp->offer_events(s, i, added);
+
+    VSOMEIP_INFO << "Offer of service " << s << " instance " << i << " repeated, " << removed.size() << " event(s) withdrawn, "
+                 << added.size() << " offered";
+    found->second.events = std::move(events);
+    found->second.is_confirmed = true;
+}
+
+void SomeipTunnel::withdrawOffer(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, const ServiceRegistration& offer) {
+    for (const auto& event : offer.events) {
+        mApp->stop_offer_event(s, i, event.event_);
+    }
+    mApp->stop_offer_service(s, i);
+}
+
+void SomeipTunnel::findService(TunnelGatewayId gateway, vsomeip_v3::service_t s, vsomeip_v3::instance_t i,
+                               std::vector<vsomeip_v3::event_registration_t>&& events, std::set<vsomeip_v3::eventgroup_t>&& groups) {
+    bool is_available = false;
+    {
+        std::lock_guard<std::mutex> lck{mServicesMutex};
+        auto& find = mFinds[{s, i}];
+        const bool is_first = find.gateways.empty();
+        const bool is_repeated = find.gateways.count(gateway) > 0;
+        find.gateways[gateway] = ServiceRegistration{gateway, std::move(events), std::move(groups), true};
+        applyFind(s, i, find);
+        if (is_first) {
+            mApp->request_service(s, i);
+            return;
+        }
+
+        VSOMEIP_INFO << "Find of service " << s << " instance " << i << (is_repeated ? " repeated" : " added") << " by gateway " << gateway
+                     << ", " << find.gateways.size() << " gateway(s) share it";
+        is_available = mAvailable.count({s, i}) > 0;
+    }
+
+    // The availability handler is not called again for a service that is already requested
+    sendServiceState(s, i, is_available);
+}
+
+bool SomeipTunnel::applyFind(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, SharedFind& find) {
+    std::vector<vsomeip_v3::event_registration_t> events;
+    std::set<vsomeip::eventgroup_t> groups;
+    mergeFinds(find.gateways, events, groups);
+
+    std::vector<vsomeip::event_t> removed;
+    std::vector<vsomeip_v3::event_registration_t> added;
+    diffEvents(find.applied.events, events, removed, added);
+    for (auto group : find.applied.groups) {
+        if (groups.count(group) == 0) {
+            mApp->unsubscribe(s, i, group);
+        }
+    }
+    for (auto event : removed) {
+        mApp->release_event(s, i, event);
+        if (mFieldCache) {
+            mFieldCache->release(s, i, event);
+        }
+        if (mTopics) {
+            mTopics->release(s, i, event);
+        }
+    }
+    if (mTopics) {
+        for (const auto& event : added) {
+            mTopics->assign(s, i, event);
+        }
+    }
+    if (!added.empty()) {
+        cacheFields(s, i, added);
+        mApp->request_events(s, i, added);
+    }
+    for (auto group : groups) {
+        if (find.applied.groups.count(group) == 0) {
+            mApp->subscribe(s, i, group);
+        }
+    }
+
+    if (find.gateways.empty()) {
+        mApp->release_service(s, i);
+        mAvailable.erase({s, i});
+        return false;
+    }
+    find.applied.events = std::move(events);
+    find.applied.groups = std::move(groups);
+    return true;
+}
+
+void SomeipTunnel::cacheFields(vsomeip_v3::service_t s, vsomeip_v3::instance_t i,
+                               const std::vector<vsomeip_v3::event_registration_t>& events) {
+    if (!mFieldCache) {
+        return;
+    }
+    for (const auto& event : events) {
+        if (event.type_ == vsomeip_v3::event_type_e::ET_FIELD) {
+            mFieldCache->assign(s, i, event.event_);
+        }
+    }
 }
 
 void SomeipTunnel::fromSomeip(const std::shared_ptr<vsomeip_v3::message>& msg) {
 
-    std::lock_guard<std::mutex> lck{mToGatewayMutex};
-    auto new_sample = mToGateway.loan().expect("should have ssample");
+    const auto received_at = std::chrono::steady_clock::now();
+    // Held until the message is published, restartGateway() replaces the lanes and flushes the
+    // correlation tables under the exclusive lock
+    std::shared_lock<std::shared_mutex> lanes{mLanesMutex};
 
-    SomeipTunnelHeader& header = new_sample.user_header_mut();
+    if (msg->get_message_type() == vsomeip_v3::message_type_e::MT_RESPONSE
+        || msg->get_message_type() == vsomeip_v3::message_type_e::MT_ERROR) {
+        // The tunnel only sends requests on behalf of the gateway
+        answerCall(msg);
+        mStats.someipToGateway.record(std::chrono::steady_clock::now() - received_at);
+        return;
+    }
+
+    auto pl = msg->get_payload();
+    auto l = pl->get_length();
+
+    // Only requests are answered, fire&forget calls and notifications need no bookkeeping
+    uint64_t id = 0;
+    if (msg->get_message_type() == vsomeip_v3::message_type_e::MT_REQUEST) {
+        id = mMessagesInProgress->insert(msg, received_at + mConfig.request_timeout);
+        if (id == 0) {
+            mStats.requestsRejected.fetch_add(1, std::memory_order_relaxed);
+            VSOMEIP_WARNING << "Too many requests in flight (" << mMessagesInProgress->capacity() << "), rejecting request for service "
+                            << msg->get_service() << " method " << msg->get_method();
+            sendError(msg, vsomeip_v3::return_code_e::E_NOT_REACHABLE);
+            return;
+        }
+    }
 
+    SomeipTunnelHeader header{};
     header.type = TunnelMsgType::MESSAGE;
+    header.message_type = static_cast<uint8_t>(msg->get_message_type());
+    header.return_code = static_cast<uint8_t>(msg->get_return_code());
+    header.interface_version = msg->get_interface_version();
 
     header.instance_id = msg->get_instance();
     header.service_id = msg->get_service();
     header.method_id = msg->get_method();
+    header.client_id = msg->get_client();
+    header.session_id = msg->get_session();
 
-    header.id = mDist(mGen);
-
-    SomeipTunnelPayload& payload = new_sample.payload_mut();
-    auto l = msg->get_payload()->get_length();
-
-    assert(l < 15000);
-
-    payload.length = (uint16_t)l;
-    std::memcpy(payload.payload, msg->get_payload()->get_data(), l);
+    header.id = id;
 
-    mMessagesInProgress.emplace(header.id, msg);
+    const vsomeip_v3::payload& its_payload{*pl};
+    if (mTraceMessages) {
+        VSOMEIP_TRACE << "Passing over tunnel message with header: " << header << ", payload: "
+                      << PayloadHexDump{iox::ImmutableSlice<uint8_t>{its_payload.get_data(), l}};
+    }
+    const bool is_notification = msg->get_message_type() == vsomeip_v3::message_type_e::MT_NOTIFICATION;
+    if (is_notification && mFieldCache) {
+        mFieldCache->update(header.service_id, header.instance_id, header.method_id, its_payload.get_data(), l);
+    }
+    const auto traffic = is_notification ? TunnelTrafficClass::Event : TunnelTrafficClass::Request;
+    TunnelPublisherPool* topic =
+            is_notification && mTopics ? mTopics->find(header.service_id, header.instance_id, header.method_id) : nullptr;
+    auto& to_gateway = topic ? *topic : laneFor(traffic, header.service_id, header.instance_id).toGateway();
+    if (is_notification && isThrottled(to_gateway, header, received_at)) {
+        // The field cache above still has the latest value
+        mStats.eventsThrottled.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    VSOMEIP_INFO << "Passing over tunnel message with header: " << header << ", payload: " << payload;
-    ::iox2::send(std::move(new_sample)).expect("Sending sample shall work");
+    if (!to_gateway.publish(header, its_payload.get_data(), l) && id != 0) {
+        // Events are only counted as dropped, but the gateway never saw the request, so the client
+        // need not wait for the timeout
+        std::shared_ptr<vsomeip::message> request;
+        if (mMessagesInProgress->take(id, request)) {
+            mStats.requestsNotReady.fetch_add(1, std::memory_order_relaxed);
+            sendError(request, vsomeip_v3::return_code_e::E_NOT_READY);
+        }
+    }
+    mStats.someipToGateway.record(std::chrono::steady_clock::now() - received_at);
 }
 
 void SomeipTunnel::start() {
@@ -125,95 +560,273 @@ void SomeipTunnel::start() {
     mApp->clear_all_handler();
 }
 
-void SomeipTunnel::recvInternal() {
+void SomeipTunnel::recvInternal(TunnelLane& lane) {
 
-    auto counter = 0;
+    while (lane.waitForGateway()) {
+        lane.fromGateway();
+        if (lane.index() == 0) {
+            this->retryControl();
+            this->expireRequests();
+            this->expireServices();
+            this->reportStats();
+        }
+    }
+}
 
-    while (mNode.wait(CYCLE_TIME).has_value() && mShallRun) {
+void SomeipTunnel::expireRequests() {
+    const auto now = std::chrono::steady_clock::now();
+    if (now < mNextExpiryCheck) {
+        return;
+    }
+    mNextExpiryCheck = now + std::min<std::chrono::steady_clock::duration>(mConfig.cycle_time, mConfig.request_timeout);
+
+    auto expired = mMessagesInProgress->expire(
+            now, [this](std::shared_ptr<vsomeip_v3::message>&& request) { sendError(request, vsomeip_v3::return_code_e::E_TIMEOUT); });
+
+    if (expired > 0) {
+        mStats.requestsExpired.fetch_add(expired, std::memory_order_relaxed);
+        VSOMEIP_WARNING << "Gateway did not answer " << expired << " request(s) in time (total expired: " << mStats.requestsExpired
+                        << ", orphan responses: " << mStats.correlationMisses << ")";
+    }
 
-        counter += 1;
-        this->fromGateway();
+    std::vector<PendingCall> expired_calls;
+    {
+        std::lock_guard<std::mutex> lck{mCallsMutex};
+        for (auto it = mCalls.begin(); it != mCalls.end();) {
+            if (it->second.deadline <= now) {
+                expired_calls.push_back(it->second);
+                it = mCalls.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (const auto& call : expired_calls) {
+        answerCallWithError(call, vsomeip_v3::return_code_e::E_TIMEOUT);
+    }
+    if (!expired_calls.empty()) {
+        mStats.requestsExpired.fetch_add(expired_calls.size(), std::memory_order_relaxed);
+        VSOMEIP_WARNING << "SOME/IP did not answer " << expired_calls.size() << " gateway request(s) in time";
     }
 }
 
-void SomeipTunnel::fromGateway() {
+void SomeipTunnel::expireServices() {
+    const auto now = std::chrono::steady_clock::now();
+    if (mConfig.event_throttle.count() > 0 && now >= mNextThrottleCleanup) {
+        // An event whose time has passed is let through like one without an entry
+        mNextThrottleCleanup = now + mConfig.event_throttle;
+        std::lock_guard<std::mutex> lck{mThrottleMutex};
+        for (auto it = mThrottled.begin(); it != mThrottled.end();) {
+            it = (it->second <= now) ? mThrottled.erase(it) : std::next(it);
+        }
+    }
 
-    do {
-        auto sample = mFromGateway.receive();
+    if (!mIsRestartPending) {
+        return;
+    }
 
-        if (sample.has_error()) {
-            std::cout << "Recv error ?!" << std::endl;
-            break;
+    std::lock_guard<std::mutex> lck{mServicesMutex};
+    std::set<TunnelGatewayId> expired;
+    for (auto it = mGraceDeadlines.begin(); it != mGraceDeadlines.end();) {
+        if (it->second <= now) {
+            expired.insert(it->first);
+            it = mGraceDeadlines.erase(it);
+        } else {
+            ++it;
         }
+    }
+    mIsRestartPending = !mGraceDeadlines.empty();
+    if (expired.empty()) {
+        return;
+    }
 
-        if (!sample->has_value()) {
+    size_t withdrawn_offers = 0;
+    size_t released_finds = 0;
+    for (auto it = mOffers.begin(); it != mOffers.end();) {
+        if (it->second.is_confirmed || expired.count(it->second.gateway) == 0) {
+            ++it;
+            continue;
+        }
+        withdrawOffer(it->first.first, it->first.second, it->second);
+        it = mOffers.erase(it);
+        withdrawn_offers++;
+    }
+    for (auto it = mFinds.begin(); it != mFinds.end();) {
+        auto& gateways = it->second.gateways;
+        bool is_changed = false;
+        for (auto find = gateways.begin(); find != gateways.end();) {
+            if (find->second.is_confirmed || expired.count(find->first) == 0) {
+                ++find;
+                continue;
+            }
+            find = gateways.erase(find);
+            is_changed = true;
+            released_finds++;
+        }
+        if (is_changed && !applyFind(it->first.first, it->first.second, it->second)) {
+            it = mFinds.erase(it);
+        } else {
+            ++it;
+        }
+    }
 
-            // std::cout << "NO sample ?!" << std::endl;
-            break;
+    VSOMEIP_INFO << "Gateway restart grace period over, withdrew " << withdrawn_offers << " offer(s) and released " << released_finds
+                 << " find(s) not repeated by the new instance(s)";
+}
+
+void SomeipTunnel::reportStats() {
+    if (!mStatsPublisher) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now < mNextStatsReport) {
+        return;
+    }
+    mNextStatsReport = now + mConfig.stats_interval;
+
+    const auto sample = mStats.snapshot();
+    VSOMEIP_INFO << "Tunnel stats: " << sample;
+    mStatsPublisher->publish(sample);
+}
+
+void SomeipTunnel::sendError(const std::shared_ptr<vsomeip_v3::message>& request, vsomeip_v3::return_code_e code) {
+    std::shared_ptr<vsomeip::message> resp = mRtm->create_response(request);
+    resp->set_message_type(vsomeip_v3::message_type_e::MT_ERROR);
+    resp->set_return_code(code);
+    mApp->send(resp);
+}
+
+void SomeipTunnel::callSomeip(TunnelLane& lane, const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload) {
+    const auto message_type = static_cast<vsomeip_v3::message_type_e>(header.message_type);
+    if (message_type != vsomeip_v3::message_type_e::MT_REQUEST && message_type != vsomeip_v3::message_type_e::MT_REQUEST_NO_RETURN) {
+        VSOMEIP_WARNING << "Ignoring gateway request for service " << header.service_id << " with message type "
+                        << static_cast<uint32_t>(header.message_type);
+        return;
+    }
+
+    std::shared_ptr<vsomeip::message> request = mRtm->create_request((header.flags & TUNNEL_FLAG_RELIABLE) != 0);
+    request->set_message_type(message_type);
+    request->set_service(header.service_id);
+    request->set_instance(header.instance_id);
+    request->set_method(header.method_id);
+    request->set_interface_version(header.interface_version);
+    // Borrows the sample memory, which stays loaned until send() has serialized the request
+    request->set_payload(mRtm->create_external_payload(payload.data(), (uint32_t)payload.number_of_elements()));
+
+    if (message_type == vsomeip_v3::message_type_e::MT_REQUEST_NO_RETURN) {
+        mApp->send(request);
+        return;
+    }
+
+    const PendingCall call{header.id, lane.index(), header, std::chrono::steady_clock::now() + mConfig.request_timeout};
+    {
+        std::lock_guard<std::mutex> lck{mCallsMutex};
+        if (mCalls.size() < mConfig.max_requests_in_flight) {
+            mApp->send(request);
+            mCalls[request->get_session()] = call;
+            return;
         }
+    }
 
-        auto& s = sample->value();
+    mStats.requestsRejected.fetch_add(1, std::memory_order_relaxed);
+    VSOMEIP_WARNING << "Too many gateway requests in flight (" << mConfig.max_requests_in_flight << "), rejecting request for service "
+                    << header.service_id << " method " << header.method_id;
+    answerCallWithError(call, vsomeip_v3::return_code_e::E_NOT_REACHABLE);
+}
 
-        this->incommingMsg(s);
+void SomeipTunnel::answerCall(const std::shared_ptr<vsomeip_v3::message>& response) {
+    PendingCall call;
+    {
+        std::lock_guard<std::mutex> lck{mCallsMutex};
+        auto found = mCalls.find(response->get_session());
+        if (found == mCalls.end() || response->get_client() != mApp->get_client()) {
+            mStats.correlationMisses.fetch_add(1, std::memory_order_relaxed);
+            VSOMEIP_WARNING << "Dropping SOME/IP response for unknown or expired session " << response->get_session() << " of service "
+                            << response->get_service();
+            return;
+        }
+        call = found->second;
+        mCalls.erase(found);
+    }
 
-    } while (true);
+    SomeipTunnelHeader header{};
+    header.type = TunnelMsgType::RESPONSE;
+    header.message_type = static_cast<uint8_t>(response->get_message_type());
+    header.return_code = static_cast<uint8_t>(response->get_return_code());
+    header.interface_version = response->get_interface_version();
+    header.service_id = response->get_service();
+    header.instance_id = response->get_instance();
+    header.method_id = response->get_method();
+    header.client_id = response->get_client();
+    header.session_id = response->get_session();
+    header.id = call.id;
+
+    const vsomeip_v3::payload& its_payload{*response->get_payload()};
+    mLanes[call.lane]->toGateway().publish(header, its_payload.get_data(), its_payload.get_length());
 }
 
-void SomeipTunnel::incommingMsg(const iox2::Sample<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>& sample) {
+void SomeipTunnel::answerCallWithError(const PendingCall& call, vsomeip_v3::return_code_e code) {
+    SomeipTunnelHeader header = call.header;
+    header.type = TunnelMsgType::RESPONSE;
+    header.flags = 0;
+    header.message_type = static_cast<uint8_t>(vsomeip_v3::message_type_e::MT_ERROR);
+    header.return_code = static_cast<uint8_t>(code);
 
-    auto header = sample.user_header();
+    mLanes[call.lane]->toGateway().publish(header, nullptr, 0);
+}
 
-    VSOMEIP_INFO << "Sample received, header: " << header << ", payload: " << sample.payload();
+void SomeipTunnel::incommingMsg(TunnelLane& lane, const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload) {
+
+    if (mTraceMessages) {
+        VSOMEIP_TRACE << "Sample received, header: " << header << ", payload: " << PayloadHexDump{payload};
+    }
 
     switch (header.type) {
     case TunnelMsgType::OFFER_SERVICE: {
-
-        for (int i = 0; i < header.service_metadata.len; i++) {
-            std::set<vsomeip::eventgroup_t> its_groups;
-            for (int j = 0; j < header.service_metadata.len; j++) {
-                its_groups.insert(header.service_metadata.event_infos[i].event_groups[j]);
-            }
-
-            mApp->offer_event(header.service_id, header.instance_id, header.service_metadata.event_infos[i].event_id, its_groups,
-                              (vsomeip_v3::event_type_e)header.service_metadata.event_infos[i].typ);
+        std::vector<vsomeip_v3::event_registration_t> its_events;
+        std::set<vsomeip::eventgroup_t> its_groups;
+        if (!readEvents(payload, its_events, its_groups)) {
+            VSOMEIP_WARNING << "Ignoring malformed event records of offer for service " << header.service_id;
+            break;
         }
 
-        mApp->offer_service(header.service_id, header.instance_id);
+        offerService(header.client_id, header.service_id, header.instance_id, std::move(its_events));
         break;
     }
     case TunnelMsgType::FIND_SERVICE: {
-
-        for (int i = 0; i < header.service_metadata.len; i++) {
-            std::set<vsomeip::eventgroup_t> its_groups;
-            for (int j = 0; j < header.service_metadata.len; j++) {
-                its_groups.insert(header.service_metadata.event_infos[i].event_groups[j]);
-            }
-
-            mApp->request_event(header.service_id, header.instance_id, header.service_metadata.event_infos[i].event_id, its_groups,
-                                (vsomeip_v3::event_type_e)header.service_metadata.event_infos[i].typ);
-            mApp->subscribe(header.service_id, header.instance_id, *its_groups.begin());
+        std::vector<vsomeip_v3::event_registration_t> its_events;
+        std::set<vsomeip::eventgroup_t> its_groups;
+        if (!readEvents(payload, its_events, its_groups)) {
+            VSOMEIP_WARNING << "Ignoring malformed event records of find for service " << header.service_id;
+            break;
         }
 
-        mApp->request_service(header.service_id, header.instance_id);
+        findService(header.client_id, header.service_id, header.instance_id, std::move(its_events), std::move(its_groups));
         break;
     }
     case TunnelMsgType::OFFER_SERVICE_ACK:
     case TunnelMsgType::FIND_SERVICE_ACK:
     case TunnelMsgType::MESSAGE: {
-        auto request = mMessagesInProgress.at(header.id);
+        std::shared_ptr<vsomeip::message> request;
+        if (!mMessagesInProgress->take(header.id, request)) {
+            mStats.correlationMisses.fetch_add(1, std::memory_order_relaxed);
+            mStats.drop(TunnelDirection::FromGateway, header.type);
+            VSOMEIP_WARNING << "Dropping gateway response for unknown or expired request id " << header.id
+                            << " (total orphan responses: " << mStats.correlationMisses << ")";
+            break;
+        }
 
         std::shared_ptr<vsomeip::message> resp = mRtm->create_response(request);
+        if (header.message_type == static_cast<uint8_t>(vsomeip_v3::message_type_e::MT_ERROR)) {
+            resp->set_message_type(vsomeip_v3::message_type_e::MT_ERROR);
+            resp->set_return_code(static_cast<vsomeip_v3::return_code_e>(header.return_code));
+        }
 
-        auto data = sample.payload();
-
-        // Create a payload which will be sent back to the client
-        std::shared_ptr<vsomeip::payload> resp_pl = mRtm->create_payload();
-
-        auto end = std::begin(data.payload);
-        std::advance(end, data.length);
+        auto data = payload;
 
-        std::vector<vsomeip::byte_t> pl_data(std::begin(data.payload), end);
-        resp_pl->set_data(pl_data);
+        // Create a payload which will be sent back to the client. It borrows the sample memory,
+        // which stays loaned until send() has serialized the response.
+        std::shared_ptr<vsomeip::payload> resp_pl = mRtm->create_external_payload(data.data(), (uint32_t)data.number_of_elements());
         resp->set_payload(resp_pl);
 
         // Send the response back
@@ -223,18 +836,69 @@ void SomeipTunnel::incommingMsg(const iox2::Sample<iox2::ServiceType::Ipc, Somei
 
     case TunnelMsgType::EVENT: {
 
-        auto data = mRtm->create_payload();
+        auto msg_data = payload;
+        // notify() copies the borrowed sample memory once into the event's cached value
+        auto data = mRtm->create_external_payload(msg_data.data(), (uint32_t)msg_data.number_of_elements());
 
-        auto msg_data = sample.payload();
+        // Send notification
+        mApp->notify(header.service_id, header.instance_id, header.method_id, data);
+        break;
+    }
 
-        auto end = std::begin(msg_data.payload);
-        std::advance(end, msg_data.length);
+    case TunnelMsgType::BATCH_CONFIG: {
+        if (payload.number_of_elements() < sizeof(TunnelBatchConfig)) {
+            VSOMEIP_WARNING << "Ignoring malformed batch configuration from the gateway";
+            break;
+        }
 
-        std::vector<vsomeip::byte_t> pl_data(std::begin(msg_data.payload), end);
-        data->set_data(pl_data);
+        TunnelBatchConfig requested;
+        std::memcpy(&requested, payload.data(), sizeof(requested));
 
-        // Send notification
-        mApp->notify(header.service_id, header.instance_id, header.method_id, data);
+        TunnelBatchConfig applied{std::min(requested.max_messages, mConfig.batch.max_messages),
+                                  std::min(requested.max_bytes, mConfig.batch.max_bytes),
+                                  std::min(requested.max_delay_us, mConfig.batch.max_delay_us)};
+        if (applied.max_messages < 2) {
+            applied = TunnelBatchConfig{0, 0, 0};
+        }
+        lane.toGateway().setBatching(applied);
+
+        VSOMEIP_INFO << "Batching towards gateway on lane " << lane.index() << ": max messages " << applied.max_messages << ", max bytes " << applied.max_bytes
+                     << ", max delay " << applied.max_delay_us << " us";
+
+        SomeipTunnelHeader ack{};
+        ack.type = TunnelMsgType::BATCH_CONFIG;
+        publishControl(lane, ack, reinterpret_cast<const uint8_t*>(&applied), sizeof(applied));
+        break;
+    }
+    case TunnelMsgType::BATCH:
+        // Batches are unpacked in fromGateway, nested batches are not supported
+        VSOMEIP_WARNING << "Ignoring nested batch from the gateway";
+        break;
+    case TunnelMsgType::REQUEST:
+        callSomeip(lane, header, payload);
+        break;
+    case TunnelMsgType::RESPONSE:
+        VSOMEIP_WARNING << "Ignoring response from the gateway, answers to tunnel requests are MESSAGE";
+        break;
+    case TunnelMsgType::HELLO: {
+        TunnelHello requested;
+        if (!readHello(payload, requested)) {
+            VSOMEIP_WARNING << "Ignoring malformed hello from the gateway";
+            break;
+        }
+
+        const TunnelHello applied = negotiateHello(requested);
+        if (applied.max_version == 0) {
+            VSOMEIP_ERROR << "Gateway supports protocol versions " << requested.min_version << " to " << requested.max_version
+                          << ", tunnel only " << static_cast<uint32_t>(TUNNEL_PROTOCOL_VERSION);
+        } else {
+            VSOMEIP_INFO << "Gateway on lane " << lane.index() << " uses protocol version " << applied.max_version << ", features 0x"
+                         << std::hex << applied.features << std::dec;
+        }
+
+        SomeipTunnelHeader ack{};
+        ack.type = TunnelMsgType::HELLO;
+        publishControl(lane, ack, reinterpret_cast<const uint8_t*>(&applied), sizeof(applied));
         break;
     }
     }
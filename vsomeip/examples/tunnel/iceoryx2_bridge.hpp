@@ -4,115 +4,35 @@
 
 #include "iox/duration.hpp"
 #include "iox2/event_id.hpp"
+#include "iox2/listener.hpp"
 #include "iox2/log.hpp"
 #include "iox2/node.hpp"
+#include "iox2/notifier.hpp"
 #include "iox2/service_name.hpp"
 #include "iox2/service_type.hpp"
 #include <iox2/subscriber.hpp>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <set>
+#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 #include <vsomeip/vsomeip.hpp>
-#include <random>
 #include <iostream>
 #include <iomanip>
 #include "iox/vector.hpp"
-
-enum class TunnelMsgType : uint32_t { OFFER_SERVICE, FIND_SERVICE, OFFER_SERVICE_ACK, FIND_SERVICE_ACK, MESSAGE, EVENT };
-
-enum class EventType : uint32_t {
-    Field,
-    Event,
-};
-
-struct SomeIPEventDesc {
-    static constexpr const char* IOX2_TYPE_NAME = "SomeIPEventDesc";
-    uint16_t event_id;
-    uint16_t event_groups[4];
-    uint8_t len;
-    EventType typ;
-};
-
-struct ServiceDescEntry {
-    static constexpr const char* IOX2_TYPE_NAME = "ServiceDescEntry";
-    SomeIPEventDesc event_infos[10];
-    uint8_t len;
-    // We can add other infos if we need
-};
-
-struct SomeipTunnelHeader {
-    static constexpr const char* IOX2_TYPE_NAME = "SomeipTunnelHeader";
-
-    TunnelMsgType type;
-    uint16_t service_id;
-    uint16_t instance_id;
-    uint16_t method_id;
-    ServiceDescEntry service_metadata; // only when typ == FindService
-
-    bool is_active; // Only relevant for FindServiceAck
-
-    uint64_t id; // if comes != 0 then shall be rewritten for response.
-};
-
-struct SomeipTunnelPayload {
-    static constexpr const char* IOX2_TYPE_NAME = "SomeipTunnelPayload";
-
-    uint16_t length;
-    uint8_t payload[1500];
-};
-
-inline std::ostream& operator<<(std::ostream& os, const EventType& typ) {
-    switch (typ) {
-    case EventType::Field:
-        os << "Field";
-        break;
-    case EventType::Event:
-        os << "Event";
-        break;
-    default:
-        os << "Unknown";
-        break;
-    }
-    return os;
-}
-
-inline std::ostream& operator<<(std::ostream& os, const SomeIPEventDesc& desc) {
-    os << "{event_id: " << desc.event_id << ", event_groups: [";
-    for (size_t i = 0; i < desc.len; ++i) {
-        os << desc.event_groups[i];
-        if (i + 1 < desc.len)
-            os << ", ";
-    }
-    os << "], typ: " << desc.typ << "}";
-    return os;
-}
-
-inline std::ostream& operator<<(std::ostream& os, const ServiceDescEntry& entry) {
-    os << "{event_infos: [";
-    for (size_t i = 0; i < entry.len; ++i) {
-        os << entry.event_infos[i];
-        if (i + 1 < entry.len)
-            os << ", ";
-    }
-    os << "]}";
-    return os;
-}
-
-inline std::ostream& operator<<(std::ostream& os, const SomeipTunnelHeader& value) {
-    os << "SomeipTunnelHeader { type: " << static_cast<uint32_t>(value.type) << ", service_id: " << value.service_id
-       << ", instance_id: " << value.instance_id << ", method_id: " << value.method_id
-       << ", find_service_metadata: " << value.service_metadata << ", id: " << value.id << " }";
-    return os;
-}
-
-inline std::ostream& operator<<(std::ostream& os, const SomeipTunnelPayload& value) {
-    os << "SomeipTunnelPayload { len: " << value.length << ", payload = ";
-    for (int i = 0; i < value.length; i++) {
-        os << std::hex << std::setw(2) << std::setfill('0') << (int)value.payload[i] << " ";
-    }
-    os << std::dec << "}";
-    return os;
-}
+#include <mutex>
+#include "correlation_table.hpp"
+#include "someip_tunnel_protocol.hpp"
+#include "tunnel_config.hpp"
+#include "tunnel_control.hpp"
+#include "tunnel_event_key.hpp"
+#include "tunnel_field_cache.hpp"
+#include "tunnel_lane.hpp"
+#include "tunnel_publisher_pool.hpp"
+#include "tunnel_stats.hpp"
+#include "tunnel_topics.hpp"
 
 class SomeipTunnel {
 
@@ -121,28 +41,127 @@ public:
     void init();
     void stop();
 
-    SomeipTunnel(std::shared_ptr<vsomeip::runtime> runtime);
+    // Warm restart for a new instance of a gateway: keeps the SOME/IP application with its offers
+    // and subscriptions and withdraws what the new instance does not offer or find again within
+    // restart_grace. If it is the only live gateway, the iceoryx2 ports are replaced and pending
+    // requests are answered with E_NOT_REACHABLE, otherwise the ports are kept. The stale resources
+    // of the old instance are removed by removeDeadNodes() beforehand. Returns false if warm restarts
+    // are disabled (restart_grace 0) and it is the only live gateway, the tunnel must then be
+    // stopped and recreated.
+    bool restartGateway(TunnelGatewayId gateway, bool isOnlyGateway);
+
+    // The configuration is read in init(), from the "tunnel" section of the vsomeip configuration
+    // overridden by the environment.
+    explicit SomeipTunnel(std::shared_ptr<vsomeip::runtime> runtime);
 
 private:
-    iox2::Node<iox2::ServiceType::Ipc> mNode;
-    std::thread mRecv;
-    std::atomic_bool mShallRun;
+    TunnelConfig mConfig;
     std::shared_ptr<vsomeip::runtime> mRtm;
     std::shared_ptr<vsomeip::application> mApp;
 
-    std::mutex mToGatewayMutex;
-    iox2::Publisher<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader> mToGateway;
-    iox2::Subscriber<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader> mFromGateway;
-
-    std::unordered_map<uint64_t, std::shared_ptr<vsomeip_v3::message>> mMessagesInProgress;
-
-    std::random_device mRd; // seed source (non-deterministic, if available)
-    std::mt19937_64 mGen; // 64-bit Mersenne Twister
-    std::uniform_int_distribution<uint64_t> mDist;
-
-    void fromGateway();
-    void recvInternal();
+    TunnelStats mStats;
+    std::unique_ptr<TunnelStatsPublisher> mStatsPublisher; // only used by the receive thread of lane 0
+    std::chrono::steady_clock::time_point mNextStatsReport;
+    bool mTraceMessages; // log every message with its payload, only at trace (verbose) level
+    std::unique_ptr<TunnelFieldCache> mFieldCache; // kept across gateway restarts
+    std::unique_ptr<TunnelTopics> mTopics; // only if topics are configured, kept across gateway restarts
+
+    // Time from which an event may pass again while its lane is congested, by eventKeyOf. Passed
+    // times are removed by expireServices().
+    std::mutex mThrottleMutex;
+    std::unordered_map<uint64_t, std::chrono::steady_clock::time_point> mThrottled;
+
+    // Dispatcher threads publish under a shared lock, restartGateway() replaces the lanes under
+    // the exclusive one. Receive threads only run while the lanes exist.
+    std::shared_mutex mLanesMutex;
+    std::vector<std::unique_ptr<TunnelLane>> mLanes;
+    std::vector<std::thread> mRecv; // one receive thread per lane
+
+    // Control messages the gateway could not take yet, in the order they were published. Retried
+    // by the receive thread of lane 0, so that neither a dispatcher thread nor a receive thread
+    // waits for a congested gateway.
+    struct ControlRetry {
+        size_t lane;
+        SomeipTunnelHeader header;
+        std::vector<uint8_t> payload;
+        size_t attempts;
+        std::chrono::milliseconds backoff;
+        std::chrono::steady_clock::time_point due;
+    };
+    std::mutex mControlRetriesMutex;
+    std::vector<ControlRetry> mControlRetries;
+    std::atomic_bool mIsControlRetryPending;
+
+    std::unique_ptr<CorrelationTable<std::shared_ptr<vsomeip_v3::message>>> mMessagesInProgress;
+    std::chrono::steady_clock::time_point mNextExpiryCheck; // only used by the receive thread of lane 0
+    std::chrono::steady_clock::time_point mNextThrottleCleanup; // only used by the receive thread of lane 0
+
+    // REQUEST of the gateway waiting for the SOME/IP response
+    struct PendingCall {
+        uint64_t id; // id of the REQUEST
+        size_t lane;
+        SomeipTunnelHeader header; // of the REQUEST, for errors generated by the tunnel
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    // Calls by SOME/IP session, which application::send() assigns. The mutex is held across
+    // send() so that a response cannot overtake the entry of its request.
+    std::mutex mCallsMutex;
+    std::unordered_map<vsomeip_v3::session_t, PendingCall> mCalls;
+
+    // OFFER_SERVICE or FIND_SERVICE of a gateway. A repeated offer or find only applies the
+    // difference to the current registration.
+    struct ServiceRegistration {
+        TunnelGatewayId gateway; // offers only, a service instance is offered by one gateway
+        std::vector<vsomeip_v3::event_registration_t> events;
+        std::set<vsomeip_v3::eventgroup_t> groups; // subscribed, finds only
+        bool is_confirmed; // by the current instance of the gateway
+    };
+    // Finds of all gateways for a service instance. The SOME/IP application requests the union of
+    // their events and subscribes each eventgroup once, however many gateways want it; all of them
+    // read the same TunnelToRust sample of an event.
+    struct SharedFind {
+        std::map<TunnelGatewayId, ServiceRegistration> gateways;
+        ServiceRegistration applied;
+    };
+    using ServiceKey = std::pair<vsomeip_v3::service_t, vsomeip_v3::instance_t>;
+
+    std::mutex mServicesMutex;
+    std::map<ServiceKey, ServiceRegistration> mOffers;
+    std::map<ServiceKey, SharedFind> mFinds;
+    std::set<ServiceKey> mAvailable; // reported by the availability handler
+    // Unconfirmed registrations of a restarted gateway are withdrawn at its deadline
+    std::atomic_bool mIsRestartPending;
+    std::map<TunnelGatewayId, std::chrono::steady_clock::time_point> mGraceDeadlines;
+
+    TunnelLane& laneFor(TunnelTrafficClass traffic, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance);
+    void startLanes();
+    void createLanes();
+    void stopLanes();
+    void recvInternal(TunnelLane& lane);
+    void expireRequests();
+    void expireServices();
+    void offerService(TunnelGatewayId gateway, vsomeip_v3::service_t s, vsomeip_v3::instance_t i,
+                      std::vector<vsomeip_v3::event_registration_t>&& events);
+    void withdrawOffer(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, const ServiceRegistration& offer);
+    void findService(TunnelGatewayId gateway, vsomeip_v3::service_t s, vsomeip_v3::instance_t i,
+                     std::vector<vsomeip_v3::event_registration_t>&& events, std::set<vsomeip_v3::eventgroup_t>&& groups);
+    bool applyFind(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, SharedFind& find);
+    void cacheFields(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, const std::vector<vsomeip_v3::event_registration_t>& events);
+    void sendServiceState(vsomeip_v3::service_t s, vsomeip_v3::instance_t i, bool active);
+    void publishControl(TunnelLane& lane, const SomeipTunnelHeader& header, const uint8_t* data, size_t length);
+    void retryControl();
+    bool isThrottled(const TunnelPublisherPool& toGateway, const SomeipTunnelHeader& header, std::chrono::steady_clock::time_point now);
+    void reportStats();
+    void sendError(const std::shared_ptr<vsomeip_v3::message>& request, vsomeip_v3::return_code_e code);
+    void callSomeip(TunnelLane& lane, const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload);
+    void answerCall(const std::shared_ptr<vsomeip_v3::message>& response);
+    void answerCallWithError(const PendingCall& call, vsomeip_v3::return_code_e code);
     void fromSomeip(const std::shared_ptr<vsomeip_v3::message>& msg);
-    void incommingMsg(const iox2::Sample<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>& sample);
+    void incommingMsg(TunnelLane& lane, const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload);
     void serviceStateChanged(vsomeip_v3::service_t, vsomeip_v3::instance_t, bool);
 };
+
+// Removes the resources of crashed processes from the iceoryx2 services, e.g. the samples a dead
+// gateway still held. Returns the PIDs of the dead nodes cleaned up.
+std::set<uint32_t> removeDeadNodes();
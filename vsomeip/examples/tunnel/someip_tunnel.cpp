@@ -12,6 +12,7 @@
 #include <iceoryx2_bridge.hpp>
 #include <csignal>
 #include <iostream>
+#include <map>
 #include <pthread.h>
 #include <thread>
 #include <unistd.h>
@@ -61,7 +62,11 @@ int main(int argc, char** argv) {
 
     std::unique_ptr<SomeipTunnel> tunnel;
     std::thread thread;
-    uint64_t currentPid = 0;
+    struct GatewayInstance {
+        uint32_t pid; // of the current instance
+        bool is_alive; // false once the dead node cleanup removed the instance
+    };
+    std::map<TunnelGatewayId, GatewayInstance> gateways;
 
     std::cout << "Entering gateway wait loop" << std::endl;
     do {
@@ -69,27 +74,62 @@ int main(int argc, char** argv) {
         auto event = listener.blocking_wait_one();
         std::cout << "Event " << std::endl;
 
-        if (currentPid == event->value().as_value()) {
+        const auto gateway = lifetimeGateway(event->value().as_value());
+        const auto pid = lifetimePid(event->value().as_value());
+        auto known = gateways.find(gateway);
+        if (known != gateways.end() && known->second.pid == pid && known->second.is_alive) {
             continue;
         }
+        const bool is_known = known != gateways.end();
+        gateways[gateway] = GatewayInstance{pid, true};
+
+        // Gateways that died keep their entry to detect a restart, but no longer share the tunnel
+        const auto dead_pids = removeDeadNodes();
+        size_t live_gateways = 0;
+        for (auto& instance : gateways) {
+            if (instance.first != gateway && dead_pids.count(instance.second.pid) > 0) {
+                instance.second.is_alive = false;
+            }
+            if (instance.second.is_alive) {
+                live_gateways++;
+            }
+        }
+        if (!dead_pids.empty()) {
+            VSOMEIP_INFO << "Removed " << dead_pids.size() << " dead iceoryx2 node(s), " << live_gateways << " live gateway(s)";
+        }
 
-        currentPid = event->value().as_value();
-
-        if (tunnel) {
-
-            std::cout << "Restart of SOME/IP gateway detected" << std::endl;
-            tunnel->stop();
-            thread.join();
+        bool is_restarted = false;
+        if (tunnel && !is_known) {
+            // The new gateway brings its own offers and finds, the tunnel keeps running
+            VSOMEIP_INFO << "Gateway " << gateway << " joined, " << live_gateways << " gateway(s) share the tunnel";
+            is_restarted = true;
+        } else if (tunnel) {
+
+            std::cout << "Restart of SOME/IP gateway " << gateway << " detected" << std::endl;
+            // Keeps the SOME/IP application and its offers, only the iceoryx2 ports of a sole
+            // live gateway are replaced
+            pthread_sigmask(SIG_BLOCK, &set, nullptr);
+            is_restarted = tunnel->restartGateway(gateway, live_gateways == 1);
+            pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
+
+            if (!is_restarted) {
+                tunnel->stop();
+                thread.join();
+            }
         }
 
-        std::cout << "Starting new instance of Tunnel" << std::endl;
+        if (!is_restarted) {
+            std::cout << "Starting new instance of Tunnel" << std::endl;
 
-        pthread_sigmask(SIG_BLOCK, &set, nullptr);
-        tunnel.reset(new SomeipTunnel(runtime));
-        tunnel->init();
-        pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
+            pthread_sigmask(SIG_BLOCK, &set, nullptr);
+            // The old tunnel has to release its iceoryx2 services (e.g. the field cache) first
+            tunnel.reset();
+            tunnel.reset(new SomeipTunnel(runtime));
+            tunnel->init();
+            pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
 
-        thread = std::thread{[&] { tunnel->start(); }};
+            thread = std::thread{[&] { tunnel->start(); }};
+        }
 
         VSOMEIP_INFO << "Tunnel ready, notifying!";
         notifier.notify().expect("Notification shall work");
@@ -0,0 +1,151 @@
+#pragma once
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#include "iox/slice.hpp"
+#include "iox2/publisher.hpp"
+#include "iox2/sample.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/subscriber.hpp"
+
+// Version of the SomeipTunnelHeader layout and of the message formats. Samples of another
+// version are dropped, except HELLO (see tunnel_control.hpp). version and type keep their place
+// at the start of the header in all versions.
+constexpr uint8_t TUNNEL_PROTOCOL_VERSION = 1;
+
+enum class TunnelMsgType : uint8_t {
+    OFFER_SERVICE, // payload is a sequence of TunnelEventRecord, client_id the TunnelGatewayId, see tunnel_control.hpp
+    FIND_SERVICE, // payload is a sequence of TunnelEventRecord, client_id the TunnelGatewayId, see tunnel_control.hpp
+    OFFER_SERVICE_ACK,
+    FIND_SERVICE_ACK, // TUNNEL_FLAG_ACTIVE is set if the service is available
+    MESSAGE,
+    EVENT,
+    BATCH, // payload is a sequence of SomeipTunnelBatchRecord, see tunnel_batch.hpp
+    BATCH_CONFIG, // payload is a TunnelBatchConfig
+    HELLO, // payload is a TunnelHello, see tunnel_control.hpp
+    REQUEST, // method call of the gateway to a SOME/IP service, message_type MT_REQUEST or MT_REQUEST_NO_RETURN
+    RESPONSE, // answer to a REQUEST with the id of the REQUEST, message_type MT_RESPONSE or MT_ERROR
+};
+
+enum class EventType : uint8_t {
+    Field,
+    Event,
+};
+
+// Bits of SomeipTunnelHeader::flags
+constexpr uint8_t TUNNEL_FLAG_ACTIVE = 0x01; // FIND_SERVICE_ACK
+constexpr uint8_t TUNNEL_FLAG_RELIABLE = 0x02; // REQUEST: use TCP if the service is remote
+
+// Fixed header of every sample. Variable-length data of control messages (event descriptions,
+// negotiation) is carried in the payload.
+struct SomeipTunnelHeader {
+    static constexpr const char* IOX2_TYPE_NAME = "SomeipTunnelHeader";
+
+    uint8_t version = TUNNEL_PROTOCOL_VERSION;
+    TunnelMsgType type;
+    uint8_t flags;
+    uint8_t return_code; // SOME/IP return code (vsomeip::return_code_e)
+    uint16_t service_id;
+    uint16_t instance_id;
+    uint16_t method_id;
+    uint16_t client_id;
+    uint16_t session_id;
+    uint8_t message_type; // SOME/IP message type (vsomeip::message_type_e)
+    uint8_t interface_version;
+
+    // != 0 for requests that expect a response, the response shall carry it unchanged. Responses
+    // with message_type MT_ERROR are sent as error with return_code.
+    uint64_t id;
+};
+
+static_assert(sizeof(SomeipTunnelHeader) == 24, "SomeipTunnelHeader is shared with the gateway");
+
+// Payload is a dynamically sized byte slice: every sample is sized to the
+// SOME/IP payload it carries, control messages use an empty slice.
+using SomeipTunnelPayload = iox::Slice<uint8_t>;
+
+using TunnelPublisher = iox2::Publisher<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>;
+using TunnelSubscriber = iox2::Subscriber<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>;
+using TunnelSample = iox2::Sample<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>;
+
+// Wrapper to log the bytes of a tunnel payload slice.
+struct PayloadHexDump {
+    iox::ImmutableSlice<uint8_t> data;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const TunnelMsgType& type) {
+    switch (type) {
+    case TunnelMsgType::OFFER_SERVICE:
+        os << "OFFER_SERVICE";
+        break;
+    case TunnelMsgType::FIND_SERVICE:
+        os << "FIND_SERVICE";
+        break;
+    case TunnelMsgType::OFFER_SERVICE_ACK:
+        os << "OFFER_SERVICE_ACK";
+        break;
+    case TunnelMsgType::FIND_SERVICE_ACK:
+        os << "FIND_SERVICE_ACK";
+        break;
+    case TunnelMsgType::MESSAGE:
+        os << "MESSAGE";
+        break;
+    case TunnelMsgType::EVENT:
+        os << "EVENT";
+        break;
+    case TunnelMsgType::BATCH:
+        os << "BATCH";
+        break;
+    case TunnelMsgType::BATCH_CONFIG:
+        os << "BATCH_CONFIG";
+        break;
+    case TunnelMsgType::HELLO:
+        os << "HELLO";
+        break;
+    case TunnelMsgType::REQUEST:
+        os << "REQUEST";
+        break;
+    case TunnelMsgType::RESPONSE:
+        os << "RESPONSE";
+        break;
+    default:
+        os << "Unknown(" << static_cast<uint32_t>(type) << ")";
+        break;
+    }
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const EventType& typ) {
+    switch (typ) {
+    case EventType::Field:
+        os << "Field";
+        break;
+    case EventType::Event:
+        os << "Event";
+        break;
+    default:
+        os << "Unknown";
+        break;
+    }
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const SomeipTunnelHeader& value) {
+    os << "SomeipTunnelHeader { version: " << static_cast<uint32_t>(value.version) << ", type: " << value.type
+       << ", flags: " << static_cast<uint32_t>(value.flags) << ", return_code: " << static_cast<uint32_t>(value.return_code)
+       << ", service_id: " << value.service_id << ", instance_id: " << value.instance_id << ", method_id: " << value.method_id
+       << ", client_id: " << value.client_id << ", session_id: " << value.session_id
+       << ", message_type: " << static_cast<uint32_t>(value.message_type) << ", interface_version: "
+       << static_cast<uint32_t>(value.interface_version) << ", id: " << value.id << " }";
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const PayloadHexDump& value) {
+    os << "SomeipTunnelPayload { len: " << value.data.number_of_elements() << ", payload = ";
+    for (auto b : value.data) {
+        os << std::hex << std::setw(2) << std::setfill('0') << (int)b << " ";
+    }
+    os << std::dec << "}";
+    return os;
+}
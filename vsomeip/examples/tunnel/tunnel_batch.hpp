@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "someip_tunnel_protocol.hpp"
+
+// Batch limits, payload of a BATCH_CONFIG message. The gateway requests limits, the tunnel answers
+// with the limits it applies (never larger than its own configuration). max_messages < 2 disables
+// batching towards the gateway. BATCH samples from the gateway are accepted at any time.
+struct TunnelBatchConfig {
+    static constexpr const char* IOX2_TYPE_NAME = "TunnelBatchConfig";
+
+    uint32_t max_messages; // flush when this many messages are batched
+    uint32_t max_bytes; // flush before a batch grows beyond this size
+    uint32_t max_delay_us; // flush at the latest this long after the first message was batched
+};
+
+// Record inside the payload of a BATCH sample. Each record is followed by `length` payload bytes
+// and padded so that the next record starts at a multiple of BATCH_RECORD_ALIGNMENT. Records are
+// not necessarily aligned in memory and must be copied out before use.
+struct SomeipTunnelBatchRecord {
+    SomeipTunnelHeader header;
+    uint32_t length;
+};
+
+constexpr size_t BATCH_RECORD_ALIGNMENT = 8;
+
+inline size_t batchRecordSize(size_t payloadLength) {
+    const size_t size = sizeof(SomeipTunnelBatchRecord) + payloadLength;
+    return (size + BATCH_RECORD_ALIGNMENT - 1) & ~(BATCH_RECORD_ALIGNMENT - 1);
+}
+
+inline void appendBatchRecord(std::vector<uint8_t>& batch, const SomeipTunnelHeader& header, const uint8_t* data, size_t length) {
+    const size_t offset = batch.size();
+    batch.resize(offset + batchRecordSize(length), 0);
+
+    SomeipTunnelBatchRecord record{header, static_cast<uint32_t>(length)};
+    std::memcpy(batch.data() + offset, &record, sizeof(record));
+    if (length > 0) {
+        std::memcpy(batch.data() + offset + sizeof(record), data, length);
+    }
+}
+
+// Calls fn(const SomeipTunnelHeader&, iox::ImmutableSlice<uint8_t>) for every record of a batch.
+// Returns false if the batch is malformed; records before the malformed one have been processed.
+template <typename Fn>
+bool forEachBatchRecord(iox::ImmutableSlice<uint8_t> batch, Fn&& fn) {
+    const uint8_t* data = batch.data();
+    const size_t size = batch.number_of_elements();
+
+    size_t offset = 0;
+    while (offset < size) {
+        if (size - offset < sizeof(SomeipTunnelBatchRecord)) {
+            return false;
+        }
+
+        SomeipTunnelBatchRecord record;
+        std::memcpy(&record, data + offset, sizeof(record));
+        if (size - offset - sizeof(record) < record.length) {
+            return false;
+        }
+
+        fn(record.header, iox::ImmutableSlice<uint8_t>{data + offset + sizeof(record), record.length});
+        offset += batchRecordSize(record.length);
+    }
+    return true;
+}
@@ -0,0 +1,354 @@
+#include "tunnel_config.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include <vsomeip/application.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+#include "../../implementation/configuration/include/configuration.hpp"
+#include "../../implementation/configuration/include/internal.hpp"
+#include "../../implementation/configuration/include/tunnel.hpp"
+
+namespace {
+// Parses "first" or "first-last" (decimal or 0x prefixed hex) into [first, last].
+bool parseRange(const std::string& text, uint16_t& first, uint16_t& last) {
+    const auto dash = text.find('-');
+    char* end = nullptr;
+
+    const auto from = std::strtoul(text.c_str(), &end, 0);
+    if (end == text.c_str() || from > UINT16_MAX) {
+        return false;
+    }
+    first = static_cast<uint16_t>(from);
+    last = first;
+
+    if (dash != std::string::npos) {
+        const char* begin = text.c_str() + dash + 1;
+        const auto to = std::strtoul(begin, &end, 0);
+        if (end == begin || to > UINT16_MAX || to < from) {
+            return false;
+        }
+        last = static_cast<uint16_t>(to);
+    }
+    return true;
+}
+
+// Parses "service[-last][.instance[-last]]=lane".
+bool parseLaneRule(const std::string& text, TunnelLaneRule& rule) {
+    const auto equals = text.find('=');
+    if (equals == std::string::npos) {
+        return false;
+    }
+
+    const auto services = text.substr(0, equals);
+    const auto dot = services.find('.');
+
+    rule.first_instance = 0x0000;
+    rule.last_instance = 0xFFFF;
+    if (!parseRange(services.substr(0, dot), rule.first_service, rule.last_service)) {
+        return false;
+    }
+    if (dot != std::string::npos && !parseRange(services.substr(dot + 1), rule.first_instance, rule.last_instance)) {
+        return false;
+    }
+
+    char* end = nullptr;
+    const char* lane = text.c_str() + equals + 1;
+    rule.lane = std::strtoul(lane, &end, 10);
+    return end != lane;
+}
+
+// Parses "service.instance.event=name".
+bool parseTopic(const std::string& text, TunnelTopicConfig& topic) {
+    const auto equals = text.find('=');
+    if (equals == std::string::npos || equals + 1 == text.size()) {
+        return false;
+    }
+
+    std::istringstream ids{text.substr(0, equals)};
+    std::array<uint16_t, 3> values{};
+    std::string id;
+    for (auto& value : values) {
+        uint16_t last = 0;
+        if (!std::getline(ids, id, '.') || !parseRange(id, value, last) || last != value) {
+            return false;
+        }
+    }
+    topic.service = values[0];
+    topic.instance = values[1];
+    topic.event = values[2];
+    topic.name = text.substr(equals + 1);
+    return true;
+}
+
+// Calls fn(index, entry) for every entry of a comma separated list.
+template <typename Fn>
+void forEachListEntry(const char* list, Fn&& fn) {
+    std::istringstream entries{list};
+    std::string entry;
+    for (size_t i = 0; std::getline(entries, entry, ','); i++) {
+        fn(i, entry);
+    }
+}
+
+void readClassLane(const char* variable, TunnelTrafficClass traffic, TunnelConfig& config) {
+    if (const char* lane = std::getenv(variable)) {
+        const auto index = std::strtoul(lane, nullptr, 10);
+        if (index >= config.lanes) {
+            VSOMEIP_WARNING << "Ignoring " << variable << "=" << lane << ", only " << config.lanes << " lane(s) configured";
+            return;
+        }
+        config.class_lanes[static_cast<size_t>(traffic)] = static_cast<int>(index);
+    }
+}
+
+TunnelLaneConfig& laneConfigEntry(TunnelConfig& config, size_t lane) {
+    if (config.lane_configs.size() <= lane) {
+        config.lane_configs.resize(lane + 1);
+    }
+    return config.lane_configs[lane];
+}
+}
+
+size_t TunnelConfig::laneFor(TunnelTrafficClass traffic, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance) const {
+    const int class_lane = class_lanes[static_cast<size_t>(traffic)];
+    if (class_lane >= 0 && static_cast<size_t>(class_lane) < lanes) {
+        return static_cast<size_t>(class_lane);
+    }
+
+    for (const auto& rule : lane_rules) {
+        if (rule.lane < lanes && service >= rule.first_service && service <= rule.last_service && instance >= rule.first_instance
+            && instance <= rule.last_instance) {
+            return rule.lane;
+        }
+    }
+
+    if (lane_hash && lanes > 1) {
+        return ((static_cast<uint32_t>(service) << 16) | instance) % lanes;
+    }
+    return 0;
+}
+
+TunnelLaneConfig TunnelConfig::lane(size_t index) const {
+    auto config = index < lane_configs.size() ? lane_configs[index] : TunnelLaneConfig{};
+    const std::string suffix = index > 0 ? "." + std::to_string(index) : "";
+    if (config.to_gateway.empty()) {
+        config.to_gateway = "TunnelToRust" + suffix;
+    }
+    if (config.from_gateway.empty()) {
+        config.from_gateway = "TunnelFromRust" + suffix;
+    }
+    return config;
+}
+
+TunnelConfig TunnelConfig::fromApplication(const vsomeip_v3::application& app) {
+    const auto configuration = app.get_configuration();
+    TunnelConfig config = fromConfiguration(*configuration->get_tunnel());
+    config.trace_messages = configuration->get_loglevel() >= vsomeip_v3::logger::level_e::LL_VERBOSE;
+    return config;
+}
+
+TunnelConfig TunnelConfig::fromConfiguration(const vsomeip_v3::cfg::tunnel& tunnel) {
+    TunnelConfig config;
+    if (!tunnel.is_configured_) {
+        return config;
+    }
+
+    if (tunnel.wait_mode_ == "event") {
+        config.wait_mode = TunnelWaitMode::Event;
+    } else if (tunnel.wait_mode_ == "hybrid") {
+        config.wait_mode = TunnelWaitMode::Hybrid;
+    } else if (tunnel.wait_mode_ == "periodic") {
+        config.wait_mode = TunnelWaitMode::Periodic;
+    } else if (!tunnel.wait_mode_.empty()) {
+        VSOMEIP_WARNING << "Unknown tunnel wait_mode \"" << tunnel.wait_mode_ << "\", using " << config.wait_mode;
+    }
+    config.cycle_time = std::chrono::milliseconds{tunnel.cycle_time_};
+    config.spin_time = std::chrono::microseconds{tunnel.spin_time_};
+    config.max_thread_publishers = tunnel.max_thread_publishers_;
+    config.max_requests_in_flight = std::max<size_t>(1, tunnel.max_requests_);
+    config.request_timeout = std::chrono::milliseconds{tunnel.request_timeout_};
+    config.stats_interval = std::chrono::milliseconds{tunnel.stats_interval_};
+    config.restart_grace = std::chrono::milliseconds{tunnel.restart_grace_};
+    config.field_cache_slots = tunnel.field_cache_slots_;
+    config.event_throttle = std::chrono::milliseconds{tunnel.event_throttle_};
+    config.max_gateways = tunnel.max_gateways_;
+    config.batch = TunnelBatchConfig{tunnel.batch_max_messages_, tunnel.batch_max_bytes_, tunnel.batch_max_delay_};
+
+    config.lanes = tunnel.lanes_.size();
+    config.lane_hash = tunnel.is_lane_hash_;
+    config.lane_rules.clear();
+    config.lane_configs.clear();
+    for (size_t i = 0; i < tunnel.lanes_.size(); i++) {
+        const auto& lane = tunnel.lanes_[i];
+
+        TunnelLaneConfig lane_config;
+        lane_config.to_gateway = lane.to_gateway_;
+        lane_config.from_gateway = lane.from_gateway_;
+        lane_config.buffer_size = lane.buffer_size_;
+        lane_config.history_size = lane.history_size_;
+        lane_config.overflow = lane.is_safe_overflow_ ? TunnelOverflow::DropOldest : TunnelOverflow::Block;
+        lane_config.max_publishers = lane.max_publishers_;
+        lane_config.max_subscribers = lane.max_subscribers_;
+        lane_config.max_loaned_samples = lane.max_loaned_samples_;
+        lane_config.initial_max_slice_len = lane.initial_max_slice_len_;
+        lane_config.cpu = lane.cpu_;
+        config.lane_configs.push_back(lane_config);
+
+        for (const auto& range : lane.services_) {
+            config.lane_rules.push_back(
+                    TunnelLaneRule{range.first_service_, range.last_service_, range.first_instance_, range.last_instance_, i});
+        }
+    }
+
+    for (const auto& topic : tunnel.topics_) {
+        TunnelTopicConfig topic_config;
+        topic_config.name = topic.name_;
+        topic_config.service = topic.service_;
+        topic_config.instance = topic.instance_;
+        topic_config.event = topic.event_;
+        topic_config.eventgroup = topic.eventgroup_;
+        topic_config.buffer_size = topic.buffer_size_;
+        topic_config.history_size = topic.history_size_;
+        config.topics.push_back(topic_config);
+    }
+
+    const std::array<int, TUNNEL_TRAFFIC_CLASSES> class_lanes{tunnel.control_lane_, tunnel.event_lane_, tunnel.request_lane_};
+    for (size_t i = 0; i < TUNNEL_TRAFFIC_CLASSES; i++) {
+        if (class_lanes[i] >= static_cast<int>(config.lanes)) {
+            VSOMEIP_WARNING << "Ignoring tunnel class lane " << class_lanes[i] << ", only " << config.lanes << " lane(s) configured";
+            config.class_lanes[i] = -1;
+        } else {
+            config.class_lanes[i] = class_lanes[i];
+        }
+    }
+
+    return config;
+}
+
+TunnelConfig TunnelConfig::fromEnvironment(TunnelConfig config) {
+
+    if (const char* mode = std::getenv("SOMEIP_TUNNEL_WAIT_MODE")) {
+        const std::string value{mode};
+        if (value == "event") {
+            config.wait_mode = TunnelWaitMode::Event;
+        } else if (value == "hybrid") {
+            config.wait_mode = TunnelWaitMode::Hybrid;
+        } else if (value == "periodic") {
+            config.wait_mode = TunnelWaitMode::Periodic;
+        } else {
+            VSOMEIP_WARNING << "Unknown SOMEIP_TUNNEL_WAIT_MODE \"" << value << "\", using " << config.wait_mode;
+        }
+    }
+    if (const char* cycle = std::getenv("SOMEIP_TUNNEL_CYCLE_TIME_MS")) {
+        config.cycle_time = std::chrono::milliseconds{std::strtoul(cycle, nullptr, 10)};
+    }
+    if (const char* spin = std::getenv("SOMEIP_TUNNEL_SPIN_TIME_US")) {
+        config.spin_time = std::chrono::microseconds{std::strtoul(spin, nullptr, 10)};
+    }
+    if (const char* publishers = std::getenv("SOMEIP_TUNNEL_MAX_THREAD_PUBLISHERS")) {
+        config.max_thread_publishers = std::strtoul(publishers, nullptr, 10);
+    }
+    if (const char* requests = std::getenv("SOMEIP_TUNNEL_MAX_REQUESTS")) {
+        config.max_requests_in_flight = std::max<size_t>(1, std::strtoul(requests, nullptr, 10));
+    }
+    if (const char* timeout = std::getenv("SOMEIP_TUNNEL_REQUEST_TIMEOUT_MS")) {
+        config.request_timeout = std::chrono::milliseconds{std::strtoul(timeout, nullptr, 10)};
+    }
+    if (const char* interval = std::getenv("SOMEIP_TUNNEL_STATS_INTERVAL_MS")) {
+        config.stats_interval = std::chrono::milliseconds{std::strtoul(interval, nullptr, 10)};
+    }
+    if (const char* grace = std::getenv("SOMEIP_TUNNEL_RESTART_GRACE_MS")) {
+        config.restart_grace = std::chrono::milliseconds{std::strtoul(grace, nullptr, 10)};
+    }
+    if (const char* slots = std::getenv("SOMEIP_TUNNEL_FIELD_CACHE_SLOTS")) {
+        config.field_cache_slots = std::strtoul(slots, nullptr, 10);
+    }
+    if (const char* throttle = std::getenv("SOMEIP_TUNNEL_EVENT_THROTTLE_MS")) {
+        config.event_throttle = std::chrono::milliseconds{std::strtoul(throttle, nullptr, 10)};
+    }
+    if (const char* gateways = std::getenv("SOMEIP_TUNNEL_MAX_GATEWAYS")) {
+        config.max_gateways = std::strtoul(gateways, nullptr, 10);
+    }
+    if (const char* messages = std::getenv("SOMEIP_TUNNEL_BATCH_MAX_MESSAGES")) {
+        config.batch.max_messages = static_cast<uint32_t>(std::strtoul(messages, nullptr, 10));
+    }
+    if (const char* bytes = std::getenv("SOMEIP_TUNNEL_BATCH_MAX_BYTES")) {
+        config.batch.max_bytes = static_cast<uint32_t>(std::strtoul(bytes, nullptr, 10));
+    }
+    if (const char* delay = std::getenv("SOMEIP_TUNNEL_BATCH_MAX_DELAY_US")) {
+        config.batch.max_delay_us = static_cast<uint32_t>(std::strtoul(delay, nullptr, 10));
+    }
+    if (const char* lanes = std::getenv("SOMEIP_TUNNEL_LANES")) {
+        config.lanes = std::max<size_t>(1, std::strtoul(lanes, nullptr, 10));
+    }
+    if (const char* map = std::getenv("SOMEIP_TUNNEL_LANE_MAP")) {
+        // Precede the rules from the configuration file
+        std::vector<TunnelLaneRule> rules;
+        forEachListEntry(map, [&config, &rules](size_t, const std::string& entry) {
+            TunnelLaneRule rule{};
+            if (!parseLaneRule(entry, rule) || rule.lane >= config.lanes) {
+                VSOMEIP_WARNING << "Ignoring invalid SOMEIP_TUNNEL_LANE_MAP entry \"" << entry << "\"";
+                return;
+            }
+            rules.push_back(rule);
+        });
+        config.lane_rules.insert(config.lane_rules.begin(), rules.begin(), rules.end());
+    }
+    if (const char* hash = std::getenv("SOMEIP_TUNNEL_LANE_HASH")) {
+        config.lane_hash = std::strtoul(hash, nullptr, 10) != 0;
+    }
+    if (const char* cpus = std::getenv("SOMEIP_TUNNEL_LANE_CPUS")) {
+        forEachListEntry(cpus, [&config](size_t lane, const std::string& entry) {
+            if (!entry.empty()) {
+                laneConfigEntry(config, lane).cpu = std::atoi(entry.c_str());
+            }
+        });
+    }
+    readClassLane("SOMEIP_TUNNEL_CONTROL_LANE", TunnelTrafficClass::Control, config);
+    readClassLane("SOMEIP_TUNNEL_EVENT_LANE", TunnelTrafficClass::Event, config);
+    readClassLane("SOMEIP_TUNNEL_REQUEST_LANE", TunnelTrafficClass::Request, config);
+    if (const char* buffers = std::getenv("SOMEIP_TUNNEL_LANE_BUFFER")) {
+        forEachListEntry(buffers, [&config](size_t lane, const std::string& entry) {
+            if (!entry.empty()) {
+                laneConfigEntry(config, lane).buffer_size = std::max<size_t>(1, std::strtoul(entry.c_str(), nullptr, 10));
+            }
+        });
+    }
+    if (const char* history = std::getenv("SOMEIP_TUNNEL_LANE_HISTORY")) {
+        forEachListEntry(history, [&config](size_t lane, const std::string& entry) {
+            if (!entry.empty()) {
+                laneConfigEntry(config, lane).history_size = std::strtoul(entry.c_str(), nullptr, 10);
+            }
+        });
+    }
+    if (const char* overflow = std::getenv("SOMEIP_TUNNEL_LANE_OVERFLOW")) {
+        forEachListEntry(overflow, [&config](size_t lane, const std::string& entry) {
+            if (entry == "drop") {
+                laneConfigEntry(config, lane).overflow = TunnelOverflow::DropOldest;
+            } else if (entry == "block") {
+                laneConfigEntry(config, lane).overflow = TunnelOverflow::Block;
+            } else if (!entry.empty()) {
+                VSOMEIP_WARNING << "Unknown SOMEIP_TUNNEL_LANE_OVERFLOW entry \"" << entry << "\" for lane " << lane;
+            }
+        });
+    }
+    if (const char* topics = std::getenv("SOMEIP_TUNNEL_TOPICS")) {
+        // Precede the topics from the configuration file
+        std::vector<TunnelTopicConfig> parsed;
+        forEachListEntry(topics, [&parsed](size_t, const std::string& entry) {
+            TunnelTopicConfig topic;
+            if (!parseTopic(entry, topic)) {
+                VSOMEIP_WARNING << "Ignoring invalid SOMEIP_TUNNEL_TOPICS entry \"" << entry << "\"";
+                return;
+            }
+            parsed.push_back(topic);
+        });
+        config.topics.insert(config.topics.begin(), parsed.begin(), parsed.end());
+    }
+
+    return config;
+}
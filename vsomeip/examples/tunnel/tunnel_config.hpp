@@ -0,0 +1,187 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "tunnel_batch.hpp"
+
+namespace vsomeip_v3 {
+class application;
+namespace cfg {
+struct tunnel;
+}
+}
+
+// How the receive thread waits for samples from the gateway.
+enum class TunnelWaitMode : uint32_t {
+    // Block on the TunnelFromRust event service, wake up on every notification.
+    Event,
+    // Busy poll for spin_time after the last received sample, then block like Event.
+    Hybrid,
+    // Poll the subscriber every cycle_time (no notifications required from the gateway).
+    Periodic,
+};
+
+// Traffic classes that can be given lanes of their own, so that they do not queue behind each other.
+enum class TunnelTrafficClass : uint32_t {
+    // Service availability and tunnel control messages
+    Control,
+    // Notifications
+    Event,
+    // Method calls and everything else
+    Request,
+};
+
+constexpr size_t TUNNEL_TRAFFIC_CLASSES = 3;
+
+// What happens if a subscriber buffer of a lane is full.
+enum class TunnelOverflow : uint32_t {
+    // The oldest sample is replaced (iceoryx2 safe overflow)
+    DropOldest,
+    // The publisher blocks until the subscriber has made room
+    Block,
+};
+
+// iceoryx2 settings of one lane. Both sides of a lane must agree on the overflow behavior,
+// iceoryx2 refuses to open a service with a different one.
+struct TunnelLaneConfig {
+    // Service names, empty: "TunnelToRust"/"TunnelFromRust" with ".n" appended for lane n > 0
+    std::string to_gateway;
+    std::string from_gateway;
+    size_t buffer_size = 20;
+    size_t history_size = 20;
+    TunnelOverflow overflow = TunnelOverflow::DropOldest;
+    // 0: max_thread_publishers + 1
+    size_t max_publishers = 0;
+    // 0: max_gateways, or the iceoryx2 default
+    size_t max_subscribers = 0;
+    // 0: iceoryx2 default
+    size_t max_loaned_samples = 0;
+    // Initial slice capacity of the TunnelToRust publishers, larger payloads grow it on demand
+    uint64_t initial_max_slice_len = 1500;
+    // CPU the receive thread of the lane is pinned to, negative: not pinned
+    int cpu = -1;
+};
+
+// Assigns the services in [first_service, last_service] x [first_instance, last_instance] to a lane.
+struct TunnelLaneRule {
+    vsomeip_v3::service_t first_service;
+    vsomeip_v3::service_t last_service;
+    vsomeip_v3::instance_t first_instance;
+    vsomeip_v3::instance_t last_instance;
+    size_t lane;
+};
+
+// Publishes the notifications of one event, or of all events of an eventgroup, on an iceoryx2
+// service of their own instead of the event lane. Exactly one of event and eventgroup is set.
+struct TunnelTopicConfig {
+    std::string name;
+    vsomeip_v3::service_t service = 0;
+    vsomeip_v3::instance_t instance = 0;
+    vsomeip_v3::event_t event = vsomeip_v3::ANY_EVENT;
+    vsomeip_v3::eventgroup_t eventgroup = vsomeip_v3::ANY_EVENTGROUP;
+    size_t buffer_size = 2;
+    size_t history_size = 1;
+};
+
+struct TunnelConfig {
+    TunnelWaitMode wait_mode = TunnelWaitMode::Event;
+    // Polling period in Periodic mode, upper bound for a blocking wait in the other modes.
+    std::chrono::milliseconds cycle_time{100};
+    std::chrono::microseconds spin_time{50};
+    // Number of dispatcher threads that get their own TunnelToRust publisher, further threads share one
+    size_t max_thread_publishers = 8;
+    // Requests forwarded to the gateway and not answered yet
+    size_t max_requests_in_flight = 1024;
+    // A request not answered within this time is answered with E_TIMEOUT
+    std::chrono::milliseconds request_timeout{5000};
+    // Upper limits for batching towards the gateway, which is only enabled on request of the gateway
+    TunnelBatchConfig batch{32, 16384, 500};
+    // Period of the statistics log line and TunnelStats sample, 0 disables both
+    std::chrono::milliseconds stats_interval{10000};
+    // Offers and subscriptions of a restarted gateway are kept this long for the new gateway to
+    // confirm them, 0 recreates the whole tunnel instead
+    std::chrono::milliseconds restart_grace{5000};
+    // Slots of the last-value cache of requested fields, 0 disables the cache
+    size_t field_cache_slots = 256;
+    // While a lane is congested, every event is forwarded at most once per interval, 0 forwards
+    // (and drops) events as they come
+    std::chrono::milliseconds event_throttle{100};
+    // Gateways sharing the tunnel, sizes the ports of the lanes. 0: iceoryx2 defaults
+    size_t max_gateways = 0;
+
+    // Number of TunnelToRust/TunnelFromRust service pairs, each served by its own receive thread
+    size_t lanes = 1;
+    // First matching rule wins. Services without a rule go to lane 0, or are spread over all
+    // lanes by (service << 16 | instance) % lanes if lane_hash is set.
+    std::vector<TunnelLaneRule> lane_rules;
+    bool lane_hash = false;
+    // Lane per traffic class, a negative value routes the class by the service mapping above
+    std::array<int, TUNNEL_TRAFFIC_CLASSES> class_lanes{-1, -1, -1};
+    // Settings per lane, lanes without an entry use the TunnelLaneConfig defaults
+    std::vector<TunnelLaneConfig> lane_configs;
+    // Event topics, a topic for the event takes precedence over one for its eventgroup
+    std::vector<TunnelTopicConfig> topics;
+    // Log every message with its payload, set if the vsomeip log level is verbose
+    bool trace_messages = false;
+
+    // Lane carrying the given class of traffic of a service instance.
+    size_t laneFor(TunnelTrafficClass traffic, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance) const;
+    // Settings of a lane with the service names filled in.
+    TunnelLaneConfig lane(size_t index) const;
+
+    // Takes the configuration from the "tunnel" section of the vsomeip configuration, if present.
+    static TunnelConfig fromConfiguration(const vsomeip_v3::cfg::tunnel& tunnel);
+    // Takes the configuration of an initialized application, see fromConfiguration().
+    static TunnelConfig fromApplication(const vsomeip_v3::application& app);
+
+    // Overrides config by the environment (SOMEIP_TUNNEL_WAIT_MODE=event|hybrid|periodic,
+    // SOMEIP_TUNNEL_CYCLE_TIME_MS, SOMEIP_TUNNEL_SPIN_TIME_US, SOMEIP_TUNNEL_MAX_THREAD_PUBLISHERS,
+    // SOMEIP_TUNNEL_MAX_REQUESTS, SOMEIP_TUNNEL_REQUEST_TIMEOUT_MS, SOMEIP_TUNNEL_STATS_INTERVAL_MS,
+    // SOMEIP_TUNNEL_RESTART_GRACE_MS, SOMEIP_TUNNEL_FIELD_CACHE_SLOTS, SOMEIP_TUNNEL_EVENT_THROTTLE_MS, SOMEIP_TUNNEL_MAX_GATEWAYS,
+    // SOMEIP_TUNNEL_BATCH_MAX_MESSAGES, SOMEIP_TUNNEL_BATCH_MAX_BYTES, SOMEIP_TUNNEL_BATCH_MAX_DELAY_US, SOMEIP_TUNNEL_LANES,
+    // SOMEIP_TUNNEL_LANE_MAP, SOMEIP_TUNNEL_LANE_HASH,
+    // SOMEIP_TUNNEL_LANE_CPUS, SOMEIP_TUNNEL_CONTROL_LANE, SOMEIP_TUNNEL_EVENT_LANE, SOMEIP_TUNNEL_REQUEST_LANE,
+    // SOMEIP_TUNNEL_LANE_BUFFER, SOMEIP_TUNNEL_LANE_HISTORY, SOMEIP_TUNNEL_LANE_OVERFLOW=drop|block,...,
+    // SOMEIP_TUNNEL_TOPICS=service.instance.event=name,...).
+    static TunnelConfig fromEnvironment(TunnelConfig config);
+};
+
+inline std::ostream& operator<<(std::ostream& os, const TunnelWaitMode& mode) {
+    switch (mode) {
+    case TunnelWaitMode::Event:
+        os << "event";
+        break;
+    case TunnelWaitMode::Hybrid:
+        os << "hybrid";
+        break;
+    case TunnelWaitMode::Periodic:
+        os << "periodic";
+        break;
+    default:
+        os << "unknown";
+        break;
+    }
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const TunnelOverflow& overflow) {
+    switch (overflow) {
+    case TunnelOverflow::DropOldest:
+        os << "drop";
+        break;
+    case TunnelOverflow::Block:
+        os << "block";
+        break;
+    default:
+        os << "unknown";
+        break;
+    }
+    return os;
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+#include <vsomeip/structured_types.hpp>
+
+#include "someip_tunnel_protocol.hpp"
+
+// Bits of TunnelHello::features
+constexpr uint32_t TUNNEL_FEATURE_BATCH = 1u << 0; // BATCH samples and BATCH_CONFIG
+constexpr uint32_t TUNNEL_FEATURE_CLIENT = 1u << 1; // REQUEST and RESPONSE
+
+// Features implemented by this tunnel
+constexpr uint32_t TUNNEL_FEATURES = TUNNEL_FEATURE_BATCH | TUNNEL_FEATURE_CLIENT;
+
+// Payload of a HELLO message. The gateway sends the protocol versions and features it supports,
+// the tunnel answers with the version both sides use (min_version == max_version) and the common
+// features. A version of 0 in the answer means the two sides have no version in common.
+struct TunnelHello {
+    static constexpr const char* IOX2_TYPE_NAME = "TunnelHello";
+
+    uint16_t min_version;
+    uint16_t max_version;
+    uint32_t features;
+};
+
+// Copies the TunnelHello out of the payload of a HELLO. Returns false if the payload is too short.
+inline bool readHello(iox::ImmutableSlice<uint8_t> payload, TunnelHello& hello) {
+    if (payload.number_of_elements() < sizeof(TunnelHello)) {
+        return false;
+    }
+    std::memcpy(&hello, payload.data(), sizeof(hello));
+    return true;
+}
+
+// Answer of the tunnel to a HELLO of the gateway.
+inline TunnelHello negotiateHello(const TunnelHello& request) {
+    if (request.min_version > TUNNEL_PROTOCOL_VERSION || request.max_version < TUNNEL_PROTOCOL_VERSION) {
+        return TunnelHello{0, 0, 0};
+    }
+    return TunnelHello{TUNNEL_PROTOCOL_VERSION, TUNNEL_PROTOCOL_VERSION, request.features & TUNNEL_FEATURES};
+}
+
+// Several gateways may share the tunnel, each with its own offers and finds. A gateway puts its id
+// into client_id of OFFER_SERVICE and FIND_SERVICE and announces itself on LifetimeFromGateway
+// with id << TUNNEL_LIFETIME_ID_SHIFT | pid. A single gateway may use id 0, i.e. send its PID only.
+using TunnelGatewayId = uint16_t;
+
+constexpr unsigned TUNNEL_LIFETIME_ID_SHIFT = 32;
+
+inline TunnelGatewayId lifetimeGateway(uint64_t lifetimeEvent) {
+    return static_cast<TunnelGatewayId>(lifetimeEvent >> TUNNEL_LIFETIME_ID_SHIFT);
+}
+
+inline uint32_t lifetimePid(uint64_t lifetimeEvent) {
+    return static_cast<uint32_t>(lifetimeEvent);
+}
+
+// Record in the payload of OFFER_SERVICE and FIND_SERVICE, one per event of the service. Each
+// record is directly followed by group_count eventgroup ids (uint16_t). Records are packed and
+// must be copied out before use.
+struct TunnelEventRecord {
+    uint16_t event_id;
+    EventType typ;
+    uint8_t group_count;
+};
+
+static_assert(sizeof(TunnelEventRecord) == 4, "TunnelEventRecord is shared with the gateway");
+
+inline void appendEventRecord(std::vector<uint8_t>& records, uint16_t eventId, EventType typ, const uint16_t* groups,
+                              uint8_t groupCount) {
+    const size_t offset = records.size();
+    records.resize(offset + sizeof(TunnelEventRecord) + groupCount * sizeof(uint16_t));
+
+    TunnelEventRecord record{eventId, typ, groupCount};
+    std::memcpy(records.data() + offset, &record, sizeof(record));
+    if (groupCount > 0) {
+        std::memcpy(records.data() + offset + sizeof(record), groups, groupCount * sizeof(uint16_t));
+    }
+}
+
+// Calls fn(const TunnelEventRecord&, const std::vector<uint16_t>& groups) for every record.
+// Returns false if the payload is malformed; records before the malformed one have been processed.
+template <typename Fn>
+bool forEachEventRecord(iox::ImmutableSlice<uint8_t> records, Fn&& fn) {
+    const uint8_t* data = records.data();
+    const size_t size = records.number_of_elements();
+
+    std::vector<uint16_t> groups;
+    size_t offset = 0;
+    while (offset < size) {
+        if (size - offset < sizeof(TunnelEventRecord)) {
+            return false;
+        }
+
+        TunnelEventRecord record;
+        std::memcpy(&record, data + offset, sizeof(record));
+        offset += sizeof(record);
+
+        const size_t groups_size = record.group_count * sizeof(uint16_t);
+        if (size - offset < groups_size) {
+            return false;
+        }
+        groups.resize(record.group_count);
+        if (groups_size > 0) {
+            std::memcpy(groups.data(), data + offset, groups_size);
+        }
+        offset += groups_size;
+
+        fn(record, groups);
+    }
+    return true;
+}
+
+// Converts the event records of an OFFER_SERVICE or FIND_SERVICE and collects their distinct
+// eventgroups. Returns false and leaves events and groups untouched if the records are malformed,
+// a truncated offer or find must not be applied partially.
+inline bool readEvents(iox::ImmutableSlice<uint8_t> payload, std::vector<vsomeip_v3::event_registration_t>& events,
+                       std::set<vsomeip_v3::eventgroup_t>& groups) {
+    std::vector<vsomeip_v3::event_registration_t> its_events;
+    std::set<vsomeip_v3::eventgroup_t> its_groups;
+    auto read = [&its_events, &its_groups](const TunnelEventRecord& event, const std::vector<uint16_t>& eventGroups) {
+        std::set<vsomeip_v3::eventgroup_t> its_event_groups(eventGroups.begin(), eventGroups.end());
+        its_groups.insert(its_event_groups.begin(), its_event_groups.end());
+        its_events.emplace_back(event.event_id, its_event_groups,
+                                event.typ == EventType::Field ? vsomeip_v3::event_type_e::ET_FIELD : vsomeip_v3::event_type_e::ET_EVENT);
+    };
+    if (!forEachEventRecord(payload, read)) {
+        return false;
+    }
+    events.insert(events.end(), its_events.begin(), its_events.end());
+    groups.insert(its_groups.begin(), its_groups.end());
+    return true;
+}
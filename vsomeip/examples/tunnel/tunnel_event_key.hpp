@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+
+#include <vsomeip/primitive_types.hpp>
+
+// Key of an event of a service instance in the maps of the tunnel: service << 32 | instance << 16 | event
+inline uint64_t eventKeyOf(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    return (static_cast<uint64_t>(service) << 32) | (static_cast<uint64_t>(instance) << 16) | event;
+}
@@ -0,0 +1,158 @@
+#include "tunnel_field_cache.hpp"
+
+#include <cstring>
+
+#include "iox2/service_name.hpp"
+
+#include <vsomeip/internal/logger.hpp>
+
+size_t TunnelFieldSlots::find(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) const {
+    auto found = mAssigned.find(eventKeyOf(service, instance, event));
+    return found != mAssigned.end() ? found->second : NONE;
+}
+
+size_t TunnelFieldSlots::assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    size_t index = 0;
+    if (!mFree.empty()) {
+        index = mFree.back();
+        mFree.pop_back();
+    } else if (mUsed < mSlots) {
+        index = mUsed++;
+    } else {
+        return NONE;
+    }
+    mAssigned[eventKeyOf(service, instance, event)] = index;
+    return index;
+}
+
+size_t TunnelFieldSlots::release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    auto found = mAssigned.find(eventKeyOf(service, instance, event));
+    if (found == mAssigned.end()) {
+        return NONE;
+    }
+    const size_t index = found->second;
+    mAssigned.erase(found);
+    mFree.push_back(index);
+    return index;
+}
+
+TunnelFieldCache::TunnelFieldCache(size_t slots) :
+    mNode{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")}, mAssigned{slots}, mIsFullLogged{false} {
+
+    auto builder = mNode.service_builder(iox2::ServiceName::create(TUNNEL_FIELD_CACHE_SERVICE).expect("valid service name"))
+                           .blackboard_creator<uint32_t>();
+    std::move(builder).add<TunnelFieldCacheInfo>(TUNNEL_FIELD_CACHE_INFO_KEY, TunnelFieldCacheInfo{static_cast<uint32_t>(slots), 0});
+    for (uint32_t key = 0; key < slots; key++) {
+        std::move(builder).add_with_default<TunnelFieldValue>(key);
+    }
+
+    auto blackboard = std::move(builder).create();
+    if (blackboard.has_error()) {
+        VSOMEIP_WARNING << "Couldn't create the " << TUNNEL_FIELD_CACHE_SERVICE << " blackboard, fields are not cached";
+        return;
+    }
+    mBlackboard.reset(new Blackboard{std::move(blackboard.value())});
+    mWriter.reset(new Writer{mBlackboard->writer_builder().create().expect("successful writer creation")});
+
+    mInfo.reset(new iox2::EntryHandleMut<iox2::ServiceType::Ipc, uint32_t, TunnelFieldCacheInfo>{
+            mWriter->entry<TunnelFieldCacheInfo>(TUNNEL_FIELD_CACHE_INFO_KEY).expect("successful entry creation")});
+    for (uint32_t key = 0; key < slots; key++) {
+        std::unique_ptr<Slot> slot{new Slot{}};
+        slot->entry.reset(new Entry{mWriter->entry<TunnelFieldValue>(key).expect("successful entry creation")});
+        mSlots.push_back(std::move(slot));
+    }
+
+    VSOMEIP_INFO << "Caching the last value of up to " << slots << " fields in " << TUNNEL_FIELD_CACHE_SERVICE;
+}
+
+void TunnelFieldCache::assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lck{mMutex};
+    if (mAssigned.find(service, instance, event) != TunnelFieldSlots::NONE) {
+        return;
+    }
+
+    const uint32_t used = mAssigned.used();
+    const size_t index = mAssigned.assign(service, instance, event);
+    if (index == TunnelFieldSlots::NONE) {
+        if (!mIsFullLogged) {
+            VSOMEIP_WARNING << "All " << mSlots.size() << " slots of " << TUNNEL_FIELD_CACHE_SERVICE << " are in use, not caching field "
+                            << service << "." << instance << "." << event << " and further ones";
+            mIsFullLogged = true;
+        }
+        return;
+    }
+    if (mAssigned.used() != used) {
+        publishInfo();
+    }
+
+    Slot& slot = *mSlots[index];
+    std::lock_guard<std::mutex> slot_lck{slot.mutex};
+    slot.value.service_id = service;
+    slot.value.instance_id = instance;
+    slot.value.event_id = event;
+    slot.value.length = 0;
+    slot.value.sequence = 0;
+    slot.is_too_large_logged = false;
+    write(slot);
+}
+
+void TunnelFieldCache::release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lck{mMutex};
+    const size_t index = mAssigned.release(service, instance, event);
+    if (index == TunnelFieldSlots::NONE) {
+        return;
+    }
+
+    Slot& slot = *mSlots[index];
+    std::lock_guard<std::mutex> slot_lck{slot.mutex};
+    slot.value = TunnelFieldValue{};
+    write(slot);
+}
+
+void TunnelFieldCache::update(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event,
+                              const uint8_t* data, size_t length) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::shared_lock<std::shared_mutex> lck{mMutex};
+    const size_t index = mAssigned.find(service, instance, event);
+    if (index == TunnelFieldSlots::NONE) {
+        return;
+    }
+
+    Slot& slot = *mSlots[index];
+    std::lock_guard<std::mutex> slot_lck{slot.mutex};
+    if (length > TUNNEL_FIELD_CACHE_MAX_PAYLOAD) {
+        if (!slot.is_too_large_logged) {
+            VSOMEIP_WARNING << "Value of field " << service << "." << instance << "." << event << " (" << length << " bytes) exceeds "
+                            << TUNNEL_FIELD_CACHE_MAX_PAYLOAD << " bytes, not cached";
+            slot.is_too_large_logged = true;
+        }
+        return;
+    }
+    slot.value.length = static_cast<uint16_t>(length);
+    if (length > 0) {
+        std::memcpy(slot.value.data, data, length);
+    }
+    slot.value.sequence++;
+    write(slot);
+}
+
+void TunnelFieldCache::write(Slot& slot) {
+    // Readers see either the old or the new value, never a mix
+    auto uninit = iox2::loan_uninit(std::move(*slot.entry));
+    *slot.entry = iox2::update(iox2::write(std::move(uninit), slot.value));
+}
+
+void TunnelFieldCache::publishInfo() {
+    mInfo->update_with_copy(TunnelFieldCacheInfo{static_cast<uint32_t>(mSlots.size()), mAssigned.used()});
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "iox2/entry_handle_mut.hpp"
+#include "iox2/entry_value.hpp"
+#include "iox2/entry_value_uninit.hpp"
+#include "iox2/node.hpp"
+#include "iox2/port_factory_blackboard.hpp"
+#include "iox2/writer.hpp"
+#include "tunnel_event_key.hpp"
+
+#include <vsomeip/primitive_types.hpp>
+
+// Name of the blackboard service holding the last values of requested fields
+constexpr const char* TUNNEL_FIELD_CACHE_SERVICE = "TunnelFieldCache";
+
+// Key of the TunnelFieldCacheInfo entry, the fields use the keys 0 to slots - 1
+constexpr uint32_t TUNNEL_FIELD_CACHE_INFO_KEY = UINT32_MAX;
+
+// Larger field values are not cached
+constexpr size_t TUNNEL_FIELD_CACHE_MAX_PAYLOAD = 1024;
+
+struct TunnelFieldCacheInfo {
+    static constexpr const char* IOX2_TYPE_NAME = "TunnelFieldCacheInfo";
+
+    uint32_t slots;
+    uint32_t used; // slots 0 to used - 1 have been assigned to a field at some point
+};
+
+// Value of a cache slot. An unused or released slot is all zero, an assigned one without a value
+// yet has sequence 0.
+struct TunnelFieldValue {
+    static constexpr const char* IOX2_TYPE_NAME = "TunnelFieldValue";
+
+    uint16_t service_id;
+    uint16_t instance_id;
+    uint16_t event_id;
+    uint16_t length; // valid bytes in data
+    uint64_t sequence; // number of values received since the slot was assigned, 0: no value yet
+    uint8_t data[TUNNEL_FIELD_CACHE_MAX_PAYLOAD];
+};
+
+// Assignment of fields to a fixed number of slots. A slot of a released field is reused for the
+// next new field. Not thread-safe.
+class TunnelFieldSlots {
+public:
+    static constexpr size_t NONE = SIZE_MAX;
+
+    explicit TunnelFieldSlots(size_t slots) : mSlots{slots}, mUsed{0} { }
+
+    // Slot of the field, NONE if it has none.
+    size_t find(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) const;
+
+    // Assigns a slot to a field that has none. Returns NONE if all slots are in use.
+    size_t assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+
+    // Returns the slot the field had, NONE if it had none.
+    size_t release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+
+    size_t size() const { return mSlots; }
+
+    // Slots 0 to used() - 1 have been assigned at some point
+    uint32_t used() const { return mUsed; }
+
+private:
+    const size_t mSlots;
+    std::unordered_map<uint64_t, size_t> mAssigned; // eventKeyOf -> slot
+    std::vector<size_t> mFree; // released slots
+    uint32_t mUsed;
+};
+
+// Last value of every field the gateway requested, kept in a blackboard so that a (re)connecting
+// gateway reads all of them at once instead of waiting for the next notification. The entries of
+// a blackboard are fixed when it is created, therefore fields are assigned to a fixed number of
+// slots. A slot of a released field is reused for the next new field.
+//
+// assign() and release() are called by the receive threads, update() by the dispatcher threads.
+class TunnelFieldCache {
+public:
+    // If the blackboard cannot be created, e.g. because another tunnel still holds it, the cache
+    // stays disabled.
+    explicit TunnelFieldCache(size_t slots);
+
+    bool isEnabled() const { return mWriter != nullptr; }
+
+    void assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+    void release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+
+    // Stores the value if the field has a slot.
+    void update(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event, const uint8_t* data,
+                size_t length);
+
+private:
+    using Node = iox2::Node<iox2::ServiceType::Ipc>;
+    using Blackboard = iox2::PortFactoryBlackboard<iox2::ServiceType::Ipc, uint32_t>;
+    using Writer = iox2::Writer<iox2::ServiceType::Ipc, uint32_t>;
+    using Entry = iox2::EntryHandleMut<iox2::ServiceType::Ipc, uint32_t, TunnelFieldValue>;
+
+    struct Slot {
+        std::mutex mutex; // dispatcher threads may notify the same field concurrently
+        std::unique_ptr<Entry> entry;
+        TunnelFieldValue value;
+        bool is_too_large_logged;
+    };
+
+    void write(Slot& slot);
+    void publishInfo();
+
+    Node mNode;
+    std::unique_ptr<Blackboard> mBlackboard;
+    std::unique_ptr<Writer> mWriter;
+    std::unique_ptr<iox2::EntryHandleMut<iox2::ServiceType::Ipc, uint32_t, TunnelFieldCacheInfo>> mInfo;
+
+    std::vector<std::unique_ptr<Slot>> mSlots;
+
+    std::shared_mutex mMutex; // protects mAssigned, update() only takes it shared
+    TunnelFieldSlots mAssigned;
+    bool mIsFullLogged;
+};
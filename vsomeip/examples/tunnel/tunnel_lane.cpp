@@ -0,0 +1,169 @@
+#include "tunnel_lane.hpp"
+
+#include "iox/duration.hpp"
+#include "iox2/event_id.hpp"
+#include "iox2/service_name.hpp"
+#include "tunnel_batch.hpp"
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace {
+using Node = iox2::Node<iox2::ServiceType::Ipc>;
+
+auto openService(Node& node, const std::string& name, const TunnelLaneConfig& lane, size_t maxPublishers, size_t maxSubscribers) {
+    auto builder = node.service_builder(iox2::ServiceName::create(name.c_str()).expect("valid service name"))
+                           .publish_subscribe<SomeipTunnelPayload>()
+                           .user_header<SomeipTunnelHeader>();
+    if (maxPublishers > 0) {
+        std::move(builder).max_publishers(maxPublishers);
+    }
+    if (maxSubscribers > 0) {
+        std::move(builder).max_subscribers(maxSubscribers);
+    }
+    return std::move(builder)
+            .subscriber_max_buffer_size(lane.buffer_size)
+            .history_size(lane.history_size)
+            .enable_safe_overflow(lane.overflow == TunnelOverflow::DropOldest)
+            .open_or_create()
+            .expect("successful service creation/opening");
+}
+
+auto openEvent(Node& node, const std::string& name, size_t maxNotifiers) {
+    auto builder = node.service_builder(iox2::ServiceName::create(name.c_str()).expect("valid service name")).event();
+    if (maxNotifiers > 0) {
+        std::move(builder).max_notifiers(maxNotifiers);
+    }
+    return std::move(builder).open_or_create().expect("successful service creation/opening");
+}
+}
+
+TunnelLane::TunnelLane(size_t index, const TunnelConfig& config, TunnelStats& stats, Handler handler) :
+    mIndex{index}, mConfig{config}, mLaneConfig{config.lane(index)}, mStats{stats}, mHandler{std::move(handler)}, mShallRun{true},
+    mIsVersionMismatchLogged{false},
+    mNode{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")},
+    mToGateway{openService(mNode, mLaneConfig.to_gateway, mLaneConfig,
+                           mLaneConfig.max_publishers > 0 ? mLaneConfig.max_publishers : config.max_thread_publishers + 1,
+                           mLaneConfig.max_subscribers > 0 ? mLaneConfig.max_subscribers : config.max_gateways),
+               openEvent(mNode, mLaneConfig.to_gateway,
+                         mLaneConfig.max_publishers > 0 ? mLaneConfig.max_publishers : config.max_thread_publishers + 1),
+               config.max_thread_publishers,
+               mLaneConfig.overflow == TunnelOverflow::Block ? iox2::UnableToDeliverStrategy::Block
+                                                             : iox2::UnableToDeliverStrategy::DiscardSample,
+               mLaneConfig.initial_max_slice_len, mLaneConfig.max_loaned_samples, &stats},
+    // Every gateway publishes and notifies, the tunnel also notifies itself on stop()
+    mFromGateway{openService(mNode, mLaneConfig.from_gateway, mLaneConfig, config.max_gateways, mLaneConfig.max_subscribers)
+                         .subscriber_builder()
+                         .buffer_size(mLaneConfig.buffer_size)
+                         .create()
+                         .expect("successful subscriber creation")},
+    mFromGatewayListener{
+            openEvent(mNode, mLaneConfig.from_gateway, config.max_gateways > 0 ? config.max_gateways + 1 : 0)
+                    .listener_builder()
+                    .create()
+                    .expect("successful listener creation")},
+    mWakeup{openEvent(mNode, mLaneConfig.from_gateway, config.max_gateways > 0 ? config.max_gateways + 1 : 0)
+                    .notifier_builder()
+                    .create()
+                    .expect("successful notifier creation")} {
+
+    VSOMEIP_INFO << "Tunnel lane " << mIndex << ": " << mLaneConfig.to_gateway << "/" << mLaneConfig.from_gateway << ", buffer size "
+                 << mLaneConfig.buffer_size << ", history size " << mLaneConfig.history_size << ", overflow " << mLaneConfig.overflow;
+}
+
+void TunnelLane::stop() {
+    mShallRun.store(false);
+    (void)mWakeup.notify();
+}
+
+bool TunnelLane::waitForGateway() {
+    if (!mShallRun) {
+        return false;
+    }
+
+    const auto cycle_time = iox::units::Duration::fromMilliseconds(static_cast<uint64_t>(mConfig.cycle_time.count()));
+    const auto drop_events = [](iox2::EventId) {};
+
+    switch (mConfig.wait_mode) {
+    case TunnelWaitMode::Periodic:
+        return mNode.wait(cycle_time).has_value() && mShallRun;
+
+    case TunnelWaitMode::Hybrid: {
+        // Notifications are consumed before each poll, so a sample published after the last poll
+        // always leaves a pending notification for the blocking wait below. The window is not
+        // extended, the caller receives and does its housekeeping in between.
+        const auto deadline = std::chrono::steady_clock::now() + mConfig.spin_time;
+        while (mShallRun && std::chrono::steady_clock::now() < deadline) {
+            if (mFromGatewayListener.try_wait_all(drop_events).has_error()) {
+                return false;
+            }
+            auto has_samples = mFromGateway.has_samples();
+            if (has_samples.has_error()) {
+                return false;
+            }
+            if (has_samples.value()) {
+                return mShallRun;
+            }
+        }
+        [[fallthrough]];
+    }
+
+    case TunnelWaitMode::Event:
+        // The timeout bounds the latency if a gateway publishes without notifying.
+        return mFromGatewayListener.timed_wait_all(drop_events, cycle_time).has_value() && mShallRun;
+    }
+
+    return false;
+}
+
+size_t TunnelLane::fromGateway() {
+
+    size_t received = 0;
+    do {
+        auto sample = mFromGateway.receive();
+
+        if (sample.has_error()) {
+            VSOMEIP_WARNING << "Receiving from " << mLaneConfig.from_gateway << " failed";
+            break;
+        }
+
+        if (!sample->has_value()) {
+            break;
+        }
+
+        auto& s = sample->value();
+        const auto received_at = std::chrono::steady_clock::now();
+
+        // Only the data path is timed. Records of a batch include the time spent on the records
+        // before them.
+        const auto handle = [this, received_at](const SomeipTunnelHeader& header, iox::ImmutableSlice<uint8_t> payload) {
+            mStats.count(TunnelDirection::FromGateway, header.type, payload.number_of_elements());
+            if (header.version != TUNNEL_PROTOCOL_VERSION && header.type != TunnelMsgType::HELLO) {
+                mStats.drop(TunnelDirection::FromGateway, header.type);
+                if (!mIsVersionMismatchLogged) {
+                    VSOMEIP_WARNING << "Dropping samples of protocol version " << static_cast<uint32_t>(header.version)
+                                    << " from the gateway on lane " << mIndex << ", expected " << static_cast<uint32_t>(TUNNEL_PROTOCOL_VERSION);
+                    mIsVersionMismatchLogged = true;
+                }
+                return;
+            }
+            mHandler(*this, header, payload);
+            if (header.type == TunnelMsgType::MESSAGE || header.type == TunnelMsgType::EVENT || header.type == TunnelMsgType::REQUEST) {
+                mStats.gatewayToSomeip.record(std::chrono::steady_clock::now() - received_at);
+            }
+        };
+
+        if (s.user_header().type == TunnelMsgType::BATCH && s.user_header().version == TUNNEL_PROTOCOL_VERSION) {
+            mStats.count(TunnelDirection::FromGateway, TunnelMsgType::BATCH, s.payload().number_of_elements());
+            if (!forEachBatchRecord(s.payload(), handle)) {
+                mStats.drop(TunnelDirection::FromGateway, TunnelMsgType::BATCH);
+                VSOMEIP_WARNING << "Dropping the rest of a malformed batch from the gateway";
+            }
+        } else {
+            handle(s.user_header(), s.payload());
+        }
+        received++;
+
+    } while (true);
+
+    return received;
+}
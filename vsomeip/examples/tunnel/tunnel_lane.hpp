@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "iox2/listener.hpp"
+#include "iox2/node.hpp"
+#include "iox2/notifier.hpp"
+#include "someip_tunnel_protocol.hpp"
+#include "tunnel_config.hpp"
+#include "tunnel_publisher_pool.hpp"
+#include "tunnel_stats.hpp"
+
+// One TunnelToRust/TunnelFromRust service pair with the event services of the same names, see
+// TunnelLaneConfig for the names and buffering.
+//
+// The lane only owns the ports, the receive thread is run by its owner, which calls
+// waitForGateway() and fromGateway() in a loop. Each lane has its own node so that receive
+// threads never share iceoryx2 objects.
+class TunnelLane {
+public:
+    // Called for every message received from the gateway, batches are already unpacked.
+    using Handler = std::function<void(TunnelLane&, const SomeipTunnelHeader&, iox::ImmutableSlice<uint8_t>)>;
+
+    // Traffic in both directions is counted in stats, the time until the handler returned from a
+    // MESSAGE, EVENT or REQUEST in stats.gatewayToSomeip.
+    TunnelLane(size_t index, const TunnelConfig& config, TunnelStats& stats, Handler handler);
+
+    size_t index() const { return mIndex; }
+    const TunnelLaneConfig& config() const { return mLaneConfig; }
+    TunnelPublisherPool& toGateway() { return mToGateway; }
+
+    // Blocks according to the wait mode until samples may be available. Returns false once the
+    // lane is stopped or the wait failed.
+    bool waitForGateway();
+
+    // Passes all pending samples to the handler, returns the number of samples received.
+    size_t fromGateway();
+
+    // Makes waitForGateway() return false.
+    void stop();
+
+private:
+    const size_t mIndex;
+    const TunnelConfig& mConfig;
+    const TunnelLaneConfig mLaneConfig;
+    TunnelStats& mStats;
+    Handler mHandler;
+    std::atomic_bool mShallRun;
+    bool mIsVersionMismatchLogged; // receive thread only
+
+    iox2::Node<iox2::ServiceType::Ipc> mNode;
+    TunnelPublisherPool mToGateway;
+    TunnelSubscriber mFromGateway;
+
+    // Event services paired with the publish-subscribe services of the same name
+    iox2::Listener<iox2::ServiceType::Ipc> mFromGatewayListener;
+    iox2::Notifier<iox2::ServiceType::Ipc> mWakeup; // wakes up mFromGatewayListener on stop()
+};
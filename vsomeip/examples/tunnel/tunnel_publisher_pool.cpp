@@ -0,0 +1,287 @@
+#include "tunnel_publisher_pool.hpp"
+
+#include <algorithm>
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace {
+std::atomic<uint64_t> gNextPoolId{1};
+
+struct ThreadCacheEntry {
+    uint64_t pool = 0; // id of the pool the entry belongs to, pools are never reused
+    void* ports = nullptr; // nullptr: thread uses the shared ports
+};
+
+// Ports of the pools a thread published to last. A thread publishing to more pools (lanes, topics)
+// falls back to the lookup in the pool, it never gets a second pair of ports from a pool.
+constexpr size_t THREAD_CACHE_SIZE = 4;
+
+struct ThreadCache {
+    ThreadCacheEntry entries[THREAD_CACHE_SIZE];
+    size_t next = 0; // entry replaced on the next miss
+};
+
+thread_local ThreadCache tCache;
+}
+
+TunnelPublisherPool::TunnelPublisherPool(ServiceFactory&& service, EventFactory&& event, size_t maxThreadPorts,
+                                         iox2::UnableToDeliverStrategy strategy, uint64_t initialMaxSliceLen, uint64_t maxLoanedSamples,
+                                         TunnelStats* stats) :
+    mId{gNextPoolId.fetch_add(1)}, mMaxThreadPorts{maxThreadPorts}, mStrategy{strategy}, mInitialMaxSliceLen{initialMaxSliceLen},
+    mMaxLoanedSamples{maxLoanedSamples}, mStats{stats}, mCongestedUntil{0}, mService{std::move(service)}, mEvent{std::move(event)},
+    mThreadPortCount{0}, mBatchMaxMessages{0}, mBatchMaxBytes{0}, mBatchMaxDelayUs{0}, mBatchPending{false},
+    mFlusherRunning{true} {
+
+    mShared = createPorts();
+    if (!mShared) {
+        VSOMEIP_ERROR << "Couldn't create TunnelToRust publisher";
+        std::abort();
+    }
+
+    mFlusher = std::thread{&TunnelPublisherPool::flush, this};
+}
+
+TunnelPublisherPool::~TunnelPublisherPool() {
+    {
+        std::lock_guard<std::mutex> lck{mFlushMutex};
+        mFlusherRunning = false;
+    }
+    mFlushCondition.notify_one();
+    mFlusher.join();
+}
+
+size_t TunnelPublisherPool::threadPortCount() const {
+    return mThreadPortCount.load(std::memory_order_relaxed);
+}
+
+void TunnelPublisherPool::setBatching(const TunnelBatchConfig& config) {
+    mBatchMaxBytes.store(config.max_bytes, std::memory_order_relaxed);
+    mBatchMaxDelayUs.store(config.max_delay_us, std::memory_order_relaxed);
+    mBatchMaxMessages.store(config.max_messages, std::memory_order_relaxed);
+
+    // Batches collected under the former limits are sent by the flusher
+    {
+        std::lock_guard<std::mutex> lck{mFlushMutex};
+        mBatchPending = true;
+    }
+    mFlushCondition.notify_one();
+}
+
+TunnelBatchConfig TunnelPublisherPool::batching() const {
+    return TunnelBatchConfig{mBatchMaxMessages.load(std::memory_order_relaxed), mBatchMaxBytes.load(std::memory_order_relaxed),
+                             mBatchMaxDelayUs.load(std::memory_order_relaxed)};
+}
+
+std::unique_ptr<TunnelPublisherPool::Ports> TunnelPublisherPool::createPorts() {
+    auto builder = mService.publisher_builder();
+    if (mMaxLoanedSamples > 0) {
+        std::move(builder).max_loaned_samples(mMaxLoanedSamples);
+    }
+    auto publisher = std::move(builder)
+                             .unable_to_deliver_strategy(mStrategy)
+                             .initial_max_slice_len(mInitialMaxSliceLen)
+                             .allocation_strategy(iox2::AllocationStrategy::PowerOfTwo)
+                             .create();
+    if (publisher.has_error()) {
+        return nullptr;
+    }
+
+    auto notifier = mEvent.notifier_builder().create();
+    if (notifier.has_error()) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<Ports>(new Ports{std::move(publisher.value()), std::move(notifier.value())});
+}
+
+TunnelPublisherPool::Ports& TunnelPublisherPool::threadPorts() {
+    for (const auto& entry : tCache.entries) {
+        if (entry.pool == mId) {
+            return entry.ports ? *static_cast<Ports*>(entry.ports) : *mShared;
+        }
+    }
+
+    Ports* ports = lookupPorts();
+    auto& entry = tCache.entries[tCache.next];
+    tCache.next = (tCache.next + 1) % THREAD_CACHE_SIZE;
+    entry.pool = mId;
+    entry.ports = ports;
+
+    return ports ? *ports : *mShared;
+}
+
+TunnelPublisherPool::Ports* TunnelPublisherPool::lookupPorts() {
+    std::lock_guard<std::mutex> lck{mPortsMutex};
+    auto found = mThreadPortMap.find(std::this_thread::get_id());
+    if (found != mThreadPortMap.end()) {
+        return found->second;
+    }
+
+    // First publish of this thread
+    Ports* ports = nullptr;
+    if (mThreadPorts.size() < mMaxThreadPorts) {
+        auto created = createPorts();
+        if (created) {
+            ports = created.get();
+            mThreadPorts.push_back(std::move(created));
+            mThreadPortCount.store(mThreadPorts.size(), std::memory_order_relaxed);
+        } else {
+            VSOMEIP_WARNING << "No TunnelToRust publisher available for dispatcher thread, sharing one";
+        }
+    }
+    mThreadPortMap.emplace(std::this_thread::get_id(), ports);
+    return ports;
+}
+
+bool TunnelPublisherPool::publish(const SomeipTunnelHeader& header, const uint8_t* data, size_t length) {
+    Ports& ports = threadPorts();
+    std::lock_guard<std::mutex> lck{ports.mutex};
+
+    const uint32_t max_messages = mBatchMaxMessages.load(std::memory_order_relaxed);
+    const uint32_t max_bytes = mBatchMaxBytes.load(std::memory_order_relaxed);
+    const size_t record_size = batchRecordSize(length);
+
+    if (max_messages < 2 || record_size > max_bytes || header.id != 0) {
+        sendBatch(ports);
+        return sendSingle(ports, header, data, length);
+    }
+
+    // Due batches of active threads do not wait for the flusher
+    if (ports.batch.size() + record_size > max_bytes || (!ports.batch.empty() && ports.batchDeadline <= Clock::now())) {
+        sendBatch(ports);
+    }
+
+    const bool is_first = ports.batch.empty();
+    appendBatchRecord(ports.batch, header, data, length);
+    ports.batchCount++;
+    if (mStats) {
+        mStats->count(TunnelDirection::ToGateway, header.type, length);
+    }
+
+    if (ports.batchCount >= max_messages) {
+        sendBatch(ports);
+    } else if (is_first) {
+        ports.batchDeadline = Clock::now() + std::chrono::microseconds(mBatchMaxDelayUs.load(std::memory_order_relaxed));
+        {
+            std::lock_guard<std::mutex> flush_lck{mFlushMutex};
+            mBatchPending = true;
+        }
+        mFlushCondition.notify_one();
+    }
+    return true;
+}
+
+bool TunnelPublisherPool::sendSingle(Ports& ports, const SomeipTunnelHeader& header, const uint8_t* data, size_t length) {
+    auto new_sample_uninit = ports.publisher.loan_slice_uninit(length);
+    if (new_sample_uninit.has_error()) {
+        if (mStats) {
+            mStats->loanFailures.fetch_add(1, std::memory_order_relaxed);
+            mStats->drop(TunnelDirection::ToGateway, header.type);
+        }
+        // Under overload every message would fail, the statistics count them
+        if (markCongested()) {
+            VSOMEIP_WARNING << "Couldn't loan a sample of " << length << " bytes, dropping " << header.type
+                            << ", gateway congested";
+        }
+        return false;
+    }
+
+    new_sample_uninit->user_header_mut() = header;
+    if (length > 0) {
+        std::memcpy(new_sample_uninit->payload_mut().data(), data, length);
+    }
+
+    if (::iox2::send(iox2::assume_init(std::move(new_sample_uninit.value()))).has_error()) {
+        if (mStats) {
+            mStats->drop(TunnelDirection::ToGateway, header.type);
+        }
+        if (markCongested()) {
+            VSOMEIP_WARNING << "Couldn't send a sample of " << length << " bytes, dropping " << header.type << ", gateway congested";
+        }
+        return false;
+    }
+    if (mStats) {
+        mStats->count(TunnelDirection::ToGateway, header.type, length);
+    }
+
+    notifyGateway(ports.notifier);
+    return true;
+}
+
+bool TunnelPublisherPool::markCongested() {
+    const auto now = Clock::now();
+    const bool was_congested = isCongested(now);
+    mCongestedUntil.store((now + CONGESTION_HOLD).time_since_epoch().count(), std::memory_order_relaxed);
+    return !was_congested;
+}
+
+void TunnelPublisherPool::sendBatch(Ports& ports) {
+    if (ports.batch.empty()) {
+        return;
+    }
+
+    SomeipTunnelHeader header{};
+    header.type = TunnelMsgType::BATCH;
+    sendSingle(ports, header, ports.batch.data(), ports.batch.size());
+
+    ports.batch.clear();
+    ports.batchCount = 0;
+}
+
+void TunnelPublisherPool::flush() {
+    std::unique_lock<std::mutex> lck{mFlushMutex};
+    Clock::time_point next = Clock::time_point::max();
+    while (mFlusherRunning) {
+        // Sleep until the earliest deadline, a new batch may be due before it
+        const auto is_woken = [this] { return mBatchPending || !mFlusherRunning; };
+        if (next == Clock::time_point::max()) {
+            mFlushCondition.wait(lck, is_woken);
+        } else {
+            mFlushCondition.wait_until(lck, next, is_woken);
+        }
+        if (!mFlusherRunning) {
+            break;
+        }
+        mBatchPending = false;
+
+        lck.unlock();
+        next = flushDue(Clock::now());
+        lck.lock();
+    }
+    lck.unlock();
+
+    // Batches still pending are sent before the pool goes away
+    flushDue(Clock::time_point::max());
+}
+
+// Ports of threads that keep publishing have no due batches here, see publish()
+TunnelPublisherPool::Clock::time_point TunnelPublisherPool::flushDue(Clock::time_point now) {
+    const bool is_enabled = mBatchMaxMessages.load(std::memory_order_relaxed) >= 2;
+    Clock::time_point next = Clock::time_point::max();
+
+    auto check = [&](Ports& ports) {
+        std::lock_guard<std::mutex> lck{ports.mutex};
+        if (ports.batch.empty()) {
+            return;
+        }
+        if (!is_enabled || ports.batchDeadline <= now) {
+            sendBatch(ports);
+        } else {
+            next = std::min(next, ports.batchDeadline);
+        }
+    };
+
+    std::lock_guard<std::mutex> lck{mPortsMutex};
+    for (auto& ports : mThreadPorts) {
+        check(*ports);
+    }
+    check(*mShared);
+
+    return next;
+}
+
+void notifyGateway(const TunnelPublisherPool::Notifier& notifier) {
+    if (notifier.notify().has_error()) {
+        VSOMEIP_WARNING << "Failed to notify gateway about new sample";
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "iox2/notifier.hpp"
+#include "iox2/port_factory_event.hpp"
+#include "iox2/port_factory_publish_subscribe.hpp"
+#include "iox2/unable_to_deliver_strategy.hpp"
+#include "someip_tunnel_protocol.hpp"
+#include "tunnel_batch.hpp"
+#include "tunnel_stats.hpp"
+
+// Hands out one publisher/notifier pair per calling thread, so that several vsomeip dispatcher
+// threads can publish to the gateway without contending on a common lock. The pair of a thread is
+// created on its first publish and found through a thread local cache afterwards, a thread keeps
+// its pair when it publishes to other pools in between. Once maxThreadPorts pairs exist, further
+// threads share one pair.
+//
+// When batching is enabled, publish() collects small messages per port into one BATCH sample.
+// A batch is sent when it reaches the message or byte limit, and at the latest after the
+// configured delay: by its own thread if that publishes again, else by a flusher thread. So the
+// flusher only sends on the ports of threads that went idle with a pending batch. This is
+// intended, the port mutex serializes it with the owning thread, which only waits for it if it
+// resumes publishing at that moment. Batches still pending on destruction are sent by the
+// flusher before it stops.
+class TunnelPublisherPool {
+public:
+    using ServiceFactory = iox2::PortFactoryPublishSubscribe<iox2::ServiceType::Ipc, SomeipTunnelPayload, SomeipTunnelHeader>;
+    using EventFactory = iox2::PortFactoryEvent<iox2::ServiceType::Ipc>;
+    using Notifier = iox2::Notifier<iox2::ServiceType::Ipc>;
+    using Clock = std::chrono::steady_clock;
+
+    // Initial slice capacity of the publisher data segment, one Ethernet MTU. Larger payloads
+    // (e.g. reassembled SOME/IP-TP messages) grow the segment on demand.
+    static constexpr uint64_t DEFAULT_INITIAL_MAX_SLICE_LEN = 1500;
+
+    // A failed publish marks the pool as congested for this long
+    static constexpr std::chrono::milliseconds CONGESTION_HOLD{1000};
+
+    // strategy applies when a subscriber buffer is full and the service has no safe overflow.
+    // maxLoanedSamples 0 keeps the iceoryx2 default. Sent messages, drops and loan failures are
+    // counted in stats, if given.
+    TunnelPublisherPool(ServiceFactory&& service, EventFactory&& event, size_t maxThreadPorts,
+                        iox2::UnableToDeliverStrategy strategy = iox2::UnableToDeliverStrategy::DiscardSample,
+                        uint64_t initialMaxSliceLen = DEFAULT_INITIAL_MAX_SLICE_LEN, uint64_t maxLoanedSamples = 0,
+                        TunnelStats* stats = nullptr);
+    ~TunnelPublisherPool();
+
+    // Calls fn(TunnelPublisher&, const Notifier&) with the ports of the calling thread. Pending
+    // batched messages of the port are sent first to keep the order.
+    template <typename Fn>
+    void withPublisher(Fn&& fn) {
+        Ports& ports = threadPorts();
+        std::lock_guard<std::mutex> lck{ports.mutex};
+        sendBatch(ports);
+        fn(ports.publisher, ports.notifier);
+    }
+
+    // Publishes one message and notifies the gateway, batched if batching is enabled. Returns
+    // false if the message was dropped because no sample could be loaned or sent. A batch that
+    // cannot be sent later is dropped as a whole, its messages were already reported as published.
+    // Therefore messages with a correlation id (header.id), which the caller answers with an error
+    // if they are dropped, are never batched.
+    bool publish(const SomeipTunnelHeader& header, const uint8_t* data, size_t length);
+
+    // High watermark: true from a failed publish until no publish failed for CONGESTION_HOLD,
+    // i.e. while the gateway does not release samples fast enough.
+    bool isCongested(Clock::time_point now) const {
+        return now.time_since_epoch().count() < mCongestedUntil.load(std::memory_order_relaxed);
+    }
+
+    // Applies new batch limits, max_messages < 2 disables batching.
+    void setBatching(const TunnelBatchConfig& config);
+    TunnelBatchConfig batching() const;
+
+    size_t threadPortCount() const;
+
+private:
+    struct Ports {
+        Ports(TunnelPublisher&& p, Notifier&& n) : publisher{std::move(p)}, notifier{std::move(n)} { }
+
+        TunnelPublisher publisher;
+        Notifier notifier;
+
+        std::mutex mutex; // owning thread vs. flusher, see above
+        std::vector<uint8_t> batch;
+        uint32_t batchCount = 0;
+        Clock::time_point batchDeadline{};
+    };
+
+    std::unique_ptr<Ports> createPorts();
+    Ports& threadPorts();
+    // Ports of the calling thread, nullptr if it uses the shared ports. Creates them on first use.
+    Ports* lookupPorts();
+
+    bool sendSingle(Ports& ports, const SomeipTunnelHeader& header, const uint8_t* data, size_t length);
+    // Returns true if the pool was not congested before.
+    bool markCongested();
+    void sendBatch(Ports& ports);
+
+    void flush();
+    Clock::time_point flushDue(Clock::time_point now);
+
+    const uint64_t mId;
+    const size_t mMaxThreadPorts;
+    const iox2::UnableToDeliverStrategy mStrategy;
+    const uint64_t mInitialMaxSliceLen;
+    const uint64_t mMaxLoanedSamples;
+    TunnelStats* const mStats;
+    std::atomic<Clock::rep> mCongestedUntil;
+
+    ServiceFactory mService;
+    EventFactory mEvent;
+
+    mutable std::mutex mPortsMutex; // port creation, mThreadPorts and mThreadPortMap
+    std::vector<std::unique_ptr<Ports>> mThreadPorts;
+    std::unordered_map<std::thread::id, Ports*> mThreadPortMap; // nullptr: shared ports
+    std::atomic<size_t> mThreadPortCount;
+    std::unique_ptr<Ports> mShared;
+
+    std::atomic<uint32_t> mBatchMaxMessages;
+    std::atomic<uint32_t> mBatchMaxBytes;
+    std::atomic<uint32_t> mBatchMaxDelayUs;
+
+    std::mutex mFlushMutex;
+    std::condition_variable mFlushCondition;
+    bool mBatchPending;
+    bool mFlusherRunning;
+    std::thread mFlusher;
+};
+
+// Notifies the gateway that a new sample is available.
+void notifyGateway(const TunnelPublisherPool::Notifier& notifier);
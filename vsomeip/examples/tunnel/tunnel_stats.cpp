@@ -0,0 +1,175 @@
+#include "tunnel_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "iox2/service_name.hpp"
+
+#include <vsomeip/internal/logger.hpp>
+
+LatencyHistogram::LatencyHistogram() : mMax{0} {
+    for (auto& count : mCounts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t value) {
+    constexpr uint64_t sub_buckets = uint64_t(1) << SUB_BUCKET_BITS;
+    if (value < sub_buckets) {
+        return static_cast<size_t>(value);
+    }
+
+    const unsigned exponent = 63 - static_cast<unsigned>(__builtin_clzll(value));
+    if (exponent >= MAX_EXPONENT) {
+        return BUCKETS - 1;
+    }
+    const uint64_t sub_bucket = (value >> (exponent - SUB_BUCKET_BITS)) & (sub_buckets - 1);
+    return static_cast<size_t>(((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + sub_bucket);
+}
+
+uint64_t LatencyHistogram::upperBoundOf(size_t bucket) {
+    constexpr uint64_t sub_buckets = uint64_t(1) << SUB_BUCKET_BITS;
+    if (bucket < sub_buckets) {
+        return bucket;
+    }
+
+    const unsigned exponent = static_cast<unsigned>(bucket >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+    const uint64_t sub_bucket = bucket & (sub_buckets - 1);
+    const uint64_t lower_bound = (sub_buckets + sub_bucket) << (exponent - SUB_BUCKET_BITS);
+    return lower_bound + (uint64_t(1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency) {
+    const uint64_t value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    mCounts[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t max = mMax.load(std::memory_order_relaxed);
+    while (value > max && !mMax.compare_exchange_weak(max, value, std::memory_order_relaxed)) { }
+}
+
+uint64_t LatencyHistogram::percentile(const std::array<uint64_t, BUCKETS>& counts, uint64_t total, double fraction) {
+    if (total == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return upperBoundOf(i);
+        }
+    }
+    return upperBoundOf(BUCKETS - 1);
+}
+
+TunnelStatsSample::Latency LatencyHistogram::summarize() const {
+    // Records arriving meanwhile may or may not be included, the copy itself is consistent
+    std::array<uint64_t, BUCKETS> counts;
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        counts[i] = mCounts[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    TunnelStatsSample::Latency summary{};
+    summary.count = total;
+    summary.max_ns = mMax.load(std::memory_order_relaxed);
+    summary.p50_ns = std::min(percentile(counts, total, 0.5), summary.max_ns);
+    summary.p90_ns = std::min(percentile(counts, total, 0.9), summary.max_ns);
+    summary.p99_ns = std::min(percentile(counts, total, 0.99), summary.max_ns);
+    summary.p999_ns = std::min(percentile(counts, total, 0.999), summary.max_ns);
+    return summary;
+}
+
+TunnelStats::TunnelStats() :
+    loanFailures{0}, correlationMisses{0}, requestsRejected{0}, requestsExpired{0}, requestsNotReady{0},
+    eventsThrottled{0}, mStart{std::chrono::steady_clock::now()} { }
+
+TunnelStatsSample TunnelStats::snapshot() const {
+    TunnelStatsSample sample{};
+    sample.uptime_ms = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mStart).count());
+
+    for (size_t direction = 0; direction < TUNNEL_DIRECTIONS; direction++) {
+        for (size_t type = 0; type < TUNNEL_MSG_TYPES; type++) {
+            const auto& counter = mCounters[direction][type];
+            sample.counters[direction][type] = TunnelStatsSample::Counter{counter.messages.load(std::memory_order_relaxed),
+                                                                          counter.bytes.load(std::memory_order_relaxed),
+                                                                          counter.drops.load(std::memory_order_relaxed)};
+        }
+    }
+
+    sample.loan_failures = loanFailures.load(std::memory_order_relaxed);
+    sample.correlation_misses = correlationMisses.load(std::memory_order_relaxed);
+    sample.requests_rejected = requestsRejected.load(std::memory_order_relaxed);
+    sample.requests_expired = requestsExpired.load(std::memory_order_relaxed);
+    sample.requests_not_ready = requestsNotReady.load(std::memory_order_relaxed);
+    sample.events_throttled = eventsThrottled.load(std::memory_order_relaxed);
+    sample.someip_to_gateway = someipToGateway.summarize();
+    sample.gateway_to_someip = gatewayToSomeip.summarize();
+    return sample;
+}
+
+namespace {
+void printCounters(std::ostream& os, const TunnelStatsSample::Counter (&counters)[TUNNEL_MSG_TYPES]) {
+    bool is_empty = true;
+    for (size_t type = 0; type < TUNNEL_MSG_TYPES; type++) {
+        const auto& counter = counters[type];
+        if (counter.messages == 0 && counter.drops == 0) {
+            continue;
+        }
+        os << (is_empty ? " " : ", ") << static_cast<TunnelMsgType>(type) << " " << counter.messages << " (" << counter.bytes << " B";
+        if (counter.drops > 0) {
+            os << ", " << counter.drops << " dropped";
+        }
+        os << ")";
+        is_empty = false;
+    }
+    if (is_empty) {
+        os << " -";
+    }
+}
+
+void printLatency(std::ostream& os, const TunnelStatsSample::Latency& latency) {
+    os << " p50/p99/p99.9/max " << latency.p50_ns / 1000 << "/" << latency.p99_ns / 1000 << "/" << latency.p999_ns / 1000 << "/"
+       << latency.max_ns / 1000 << " us (" << latency.count << ")";
+}
+}
+
+std::ostream& operator<<(std::ostream& os, const TunnelStatsSample& sample) {
+    os << "uptime " << sample.uptime_ms / 1000 << " s, to gateway:";
+    printCounters(os, sample.counters[static_cast<size_t>(TunnelDirection::ToGateway)]);
+    os << "; from gateway:";
+    printCounters(os, sample.counters[static_cast<size_t>(TunnelDirection::FromGateway)]);
+    os << "; loan failures " << sample.loan_failures << ", correlation misses " << sample.correlation_misses << ", rejected "
+       << sample.requests_rejected << ", expired " << sample.requests_expired << ", not ready " << sample.requests_not_ready
+       << ", throttled events " << sample.events_throttled << "; SOME/IP->gateway";
+    printLatency(os, sample.someip_to_gateway);
+    os << ", gateway->SOME/IP";
+    printLatency(os, sample.gateway_to_someip);
+    return os;
+}
+
+TunnelStatsPublisher::TunnelStatsPublisher() :
+    mNode{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")},
+    mPublisher{mNode.service_builder(iox2::ServiceName::create(TUNNEL_STATS_SERVICE).expect("valid service name"))
+                       .publish_subscribe<TunnelStatsSample>()
+                       .history_size(1)
+                       .open_or_create()
+                       .expect("successful service creation/opening")
+                       .publisher_builder()
+                       .create()
+                       .expect("successful publisher creation")} { }
+
+void TunnelStatsPublisher::publish(const TunnelStatsSample& sample) {
+    auto uninit = mPublisher.loan_uninit();
+    if (uninit.has_error()) {
+        VSOMEIP_WARNING << "Couldn't loan a " << TUNNEL_STATS_SERVICE << " sample";
+        return;
+    }
+
+    if (::iox2::send(uninit->write_payload(TunnelStatsSample{sample})).has_error()) {
+        VSOMEIP_WARNING << "Couldn't publish on " << TUNNEL_STATS_SERVICE;
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "iox2/node.hpp"
+#include "iox2/publisher.hpp"
+#include "someip_tunnel_protocol.hpp"
+
+enum class TunnelDirection : uint32_t {
+    ToGateway,
+    FromGateway,
+};
+
+constexpr size_t TUNNEL_DIRECTIONS = 2;
+constexpr size_t TUNNEL_MSG_TYPES = static_cast<size_t>(TunnelMsgType::RESPONSE) + 1;
+
+// Name of the publish-subscribe service carrying TunnelStatsSample
+constexpr const char* TUNNEL_STATS_SERVICE = "TunnelStats";
+
+// Payload of the TunnelStats service, published periodically with history 1 so that a tool
+// gets the latest values when it connects. All values are totals since the tunnel started.
+struct TunnelStatsSample {
+    static constexpr const char* IOX2_TYPE_NAME = "TunnelStatsSample";
+
+    struct Counter {
+        uint64_t messages;
+        uint64_t bytes;
+        uint64_t drops;
+    };
+
+    struct Latency {
+        uint64_t count;
+        uint64_t p50_ns;
+        uint64_t p90_ns;
+        uint64_t p99_ns;
+        uint64_t p999_ns;
+        uint64_t max_ns;
+    };
+
+    uint64_t uptime_ms;
+    Counter counters[TUNNEL_DIRECTIONS][TUNNEL_MSG_TYPES]; // indexed by TunnelDirection and TunnelMsgType
+    uint64_t loan_failures;
+    uint64_t correlation_misses;
+    uint64_t requests_rejected;
+    uint64_t requests_expired;
+    uint64_t requests_not_ready; // could not be published, answered with E_NOT_READY
+    uint64_t events_throttled; // not forwarded while the lane was congested
+    Latency someip_to_gateway; // SOME/IP message handler entry until handed to iceoryx2 (or to a batch)
+    Latency gateway_to_someip; // gateway sample received until app->send()/notify() returned
+};
+
+// Latency histogram with logarithmic buckets, each power of two split into 2^SUB_BUCKET_BITS
+// linear sub-buckets like HdrHistogram. Values are reported as the upper bound of their bucket,
+// with a relative error below 2^-SUB_BUCKET_BITS. record() is wait-free.
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr unsigned MAX_EXPONENT = 40; // larger values (> 18 min in ns) go to the last bucket
+    static constexpr size_t BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    LatencyHistogram();
+
+    void record(std::chrono::nanoseconds latency);
+    TunnelStatsSample::Latency summarize() const;
+
+    static size_t bucketOf(uint64_t value);
+    static uint64_t upperBoundOf(size_t bucket);
+
+private:
+    // Upper bound of the bucket below which the given fraction (0..1) of the total values in
+    // counts lies. counts is a copy of mCounts, total the sum of its elements.
+    static uint64_t percentile(const std::array<uint64_t, BUCKETS>& counts, uint64_t total, double fraction);
+
+    std::array<std::atomic<uint64_t>, BUCKETS> mCounts;
+    std::atomic<uint64_t> mMax;
+};
+
+// Counters of the tunnel, shared by all lanes and dispatcher threads. Every counter is a relaxed
+// atomic; the counters of one direction and message type share a cache line.
+class TunnelStats {
+public:
+    TunnelStats();
+
+    void count(TunnelDirection direction, TunnelMsgType type, size_t bytes) {
+        if (auto* counter = find(direction, type)) {
+            counter->messages.fetch_add(1, std::memory_order_relaxed);
+            counter->bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    void drop(TunnelDirection direction, TunnelMsgType type) {
+        if (auto* counter = find(direction, type)) {
+            counter->drops.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    TunnelStatsSample snapshot() const;
+
+    std::atomic<uint64_t> loanFailures;
+    std::atomic<uint64_t> correlationMisses; // gateway answers for unknown/expired ids
+    std::atomic<uint64_t> requestsRejected; // table full, answered with E_NOT_REACHABLE
+    std::atomic<uint64_t> requestsExpired; // answered with E_TIMEOUT
+    std::atomic<uint64_t> requestsNotReady; // publish failed, answered with E_NOT_READY
+    std::atomic<uint64_t> eventsThrottled;
+
+    LatencyHistogram someipToGateway;
+    LatencyHistogram gatewayToSomeip;
+
+private:
+    struct alignas(64) Counter {
+        std::atomic<uint64_t> messages{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> drops{0};
+    };
+
+    Counter* find(TunnelDirection direction, TunnelMsgType type) {
+        const auto index = static_cast<size_t>(type);
+        // The type of gateway messages is not trusted
+        return index < TUNNEL_MSG_TYPES ? &mCounters[static_cast<size_t>(direction)][index] : nullptr;
+    }
+
+    const std::chrono::steady_clock::time_point mStart;
+    Counter mCounters[TUNNEL_DIRECTIONS][TUNNEL_MSG_TYPES];
+};
+
+// One line summary for the periodic log.
+std::ostream& operator<<(std::ostream& os, const TunnelStatsSample& sample);
+
+// Publishes snapshots on TUNNEL_STATS_SERVICE. Only used by one thread.
+class TunnelStatsPublisher {
+public:
+    TunnelStatsPublisher();
+
+    void publish(const TunnelStatsSample& sample);
+
+private:
+    iox2::Node<iox2::ServiceType::Ipc> mNode;
+    iox2::Publisher<iox2::ServiceType::Ipc, TunnelStatsSample, void> mPublisher;
+};
@@ -0,0 +1,37 @@
+#include <cstring>
+#include <iostream>
+
+#include "iox/duration.hpp"
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "iox2/subscriber.hpp"
+#include "tunnel_stats.hpp"
+
+// Prints the samples of the TunnelStats service of a running tunnel, "--once" exits after the
+// latest one.
+int main(int argc, char** argv) {
+    const bool is_once = (argc > 1 && std::strcmp(argv[1], "--once") == 0);
+
+    auto node = iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation");
+    auto subscriber = node.service_builder(iox2::ServiceName::create(TUNNEL_STATS_SERVICE).expect("valid service name"))
+                              .publish_subscribe<TunnelStatsSample>()
+                              .history_size(1)
+                              .open_or_create()
+                              .expect("successful service creation/opening")
+                              .subscriber_builder()
+                              .create()
+                              .expect("successful subscriber creation");
+
+    while (node.wait(iox::units::Duration::fromMilliseconds(100)).has_value()) {
+        auto sample = subscriber.receive().expect("receive succeeds");
+        while (sample.has_value()) {
+            std::cout << sample->payload() << std::endl;
+            if (is_once) {
+                return 0;
+            }
+            sample = subscriber.receive().expect("receive succeeds");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "tunnel_topics.hpp"
+
+#include <mutex>
+
+#include "iox2/service_name.hpp"
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace {
+using Node = iox2::Node<iox2::ServiceType::Ipc>;
+
+// A topic carries the latest values of its events, a full buffer drops the oldest sample
+auto openService(Node& node, const TunnelTopicConfig& topic, size_t maxPublishers) {
+    return node.service_builder(iox2::ServiceName::create(topic.name.c_str()).expect("valid service name"))
+            .publish_subscribe<SomeipTunnelPayload>()
+            .user_header<SomeipTunnelHeader>()
+            .max_publishers(maxPublishers)
+            .subscriber_max_buffer_size(topic.buffer_size)
+            .history_size(topic.history_size)
+            .enable_safe_overflow(true)
+            .open_or_create()
+            .expect("successful service creation/opening");
+}
+
+auto openEvent(Node& node, const TunnelTopicConfig& topic, size_t maxNotifiers) {
+    return node.service_builder(iox2::ServiceName::create(topic.name.c_str()).expect("valid service name"))
+            .event()
+            .max_notifiers(maxNotifiers)
+            .open_or_create()
+            .expect("successful service creation/opening");
+}
+}
+
+size_t topicOf(const std::vector<TunnelTopicConfig>& topics, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance,
+               const vsomeip_v3::event_registration_t& event) {
+    for (size_t i = 0; i < topics.size(); i++) {
+        const auto& topic = topics[i];
+        if (topic.service == service && topic.instance == instance && topic.event == event.event_) {
+            return i;
+        }
+    }
+    for (size_t i = 0; i < topics.size(); i++) {
+        const auto& topic = topics[i];
+        if (topic.service == service && topic.instance == instance && event.eventgroups_.count(topic.eventgroup) > 0) {
+            return i;
+        }
+    }
+    return topics.size();
+}
+
+TunnelTopics::TunnelTopics(const TunnelConfig& config, TunnelStats& stats) :
+    mConfigs{config.topics}, mNode{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")} {
+
+    for (const auto& topic : mConfigs) {
+        const size_t max_publishers = config.max_thread_publishers + 1;
+        mTopics.emplace_back(new TunnelPublisherPool{openService(mNode, topic, max_publishers), openEvent(mNode, topic, max_publishers),
+                                                     config.max_thread_publishers, iox2::UnableToDeliverStrategy::DiscardSample,
+                                                     TunnelPublisherPool::DEFAULT_INITIAL_MAX_SLICE_LEN, 0, &stats});
+
+        VSOMEIP_INFO << "Tunnel topic " << topic.name << ": service " << topic.service << " instance " << topic.instance
+                     << (topic.event != vsomeip_v3::ANY_EVENT ? " event " : " eventgroup ")
+                     << (topic.event != vsomeip_v3::ANY_EVENT ? topic.event : topic.eventgroup) << ", buffer size " << topic.buffer_size
+                     << ", history size " << topic.history_size;
+    }
+}
+
+void TunnelTopics::assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, const vsomeip_v3::event_registration_t& event) {
+    const size_t index = topicOf(mConfigs, service, instance, event);
+    if (index == mConfigs.size()) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lck{mMutex};
+    mAssigned.emplace(eventKeyOf(service, instance, event.event_), mTopics[index].get());
+}
+
+void TunnelTopics::release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    std::unique_lock<std::shared_mutex> lck{mMutex};
+    mAssigned.erase(eventKeyOf(service, instance, event));
+}
+
+TunnelPublisherPool* TunnelTopics::find(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event) {
+    std::shared_lock<std::shared_mutex> lck{mMutex};
+    auto found = mAssigned.find(eventKeyOf(service, instance, event));
+    return found != mAssigned.end() ? found->second : nullptr;
+}
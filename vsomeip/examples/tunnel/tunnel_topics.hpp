@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "iox2/node.hpp"
+#include "tunnel_config.hpp"
+#include "tunnel_event_key.hpp"
+#include "tunnel_publisher_pool.hpp"
+#include "tunnel_stats.hpp"
+
+#include <vsomeip/primitive_types.hpp>
+#include <vsomeip/structured_types.hpp>
+
+// Index of the topic the event is bound to: the first one configured for the event or, failing
+// that, for one of its eventgroups. topics.size() if there is none, the event goes over the event lane.
+size_t topicOf(const std::vector<TunnelTopicConfig>& topics, vsomeip_v3::service_t service, vsomeip_v3::instance_t instance,
+               const vsomeip_v3::event_registration_t& event);
+
+// Publish-subscribe services of the configured topics (TunnelTopicConfig). Notifications of an
+// event bound to a topic are published there instead of on the event lane, so that a consumer
+// only subscribes to the events it is interested in and is only woken up for them. A topic sample
+// has the same SomeipTunnelHeader and payload as on the lane, every topic has an event service of
+// the same name.
+//
+// The services are created up front, events are bound to a topic when they are requested. assign()
+// and release() are called by the receive threads, find() by the dispatcher threads.
+class TunnelTopics {
+public:
+    TunnelTopics(const TunnelConfig& config, TunnelStats& stats);
+
+    // Binds the event to the topic configured for it or, failing that, for one of its eventgroups.
+    void assign(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, const vsomeip_v3::event_registration_t& event);
+    void release(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+
+    // Topic the event is bound to, nullptr if it goes over the event lane.
+    TunnelPublisherPool* find(vsomeip_v3::service_t service, vsomeip_v3::instance_t instance, vsomeip_v3::event_t event);
+
+    size_t size() const { return mTopics.size(); }
+
+private:
+    const std::vector<TunnelTopicConfig> mConfigs;
+    iox2::Node<iox2::ServiceType::Ipc> mNode;
+    std::vector<std::unique_ptr<TunnelPublisherPool>> mTopics; // same index as mConfigs
+
+    std::shared_mutex mMutex; // protects mAssigned, find() only takes it shared
+    std::unordered_map<uint64_t, TunnelPublisherPool*> mAssigned; // eventKeyOf -> topic
+};
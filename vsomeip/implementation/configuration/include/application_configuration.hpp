@@ -30,6 +30,8 @@ struct application_configuration {
     int nice_level_;
     debounce_configuration_t debounces_;
     bool has_session_handling_;
+    std::size_t dispatcher_threads_;
+    std::size_t message_pool_capacity_;
 };
 
 } // namespace cfg
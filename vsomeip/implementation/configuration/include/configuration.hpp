@@ -32,6 +32,8 @@
 #include "internal.hpp"
 #endif // ANDROID
 
+#include "tunnel.hpp"
+
 #include "../../security/include/policy.hpp"
 
 #define VSOMEIP_CONFIG_PLUGIN_VERSION              1
@@ -121,6 +123,8 @@ public:
 
     virtual std::size_t get_max_dispatchers(const std::string& _name) const = 0;
     virtual std::size_t get_max_dispatch_time(const std::string& _name) const = 0;
+    virtual std::size_t get_dispatcher_threads(const std::string& _name) const = 0;
+    virtual std::size_t get_message_pool_capacity(const std::string& _name) const = 0;
     virtual std::size_t get_max_detached_thread_wait_time(const std::string& _name) const = 0;
     virtual std::size_t get_io_thread_count(const std::string& _name) const = 0;
     virtual int get_io_thread_nice_level(const std::string& _name) const = 0;
@@ -173,6 +177,9 @@ public:
     // Trace configuration
     virtual std::shared_ptr<cfg::trace> get_trace() const = 0;
 
+    // iceoryx2 tunnel configuration
+    virtual std::shared_ptr<cfg::tunnel> get_tunnel() const = 0;
+
     // Watchdog
     virtual bool is_watchdog_enabled() const = 0;
     virtual uint32_t get_watchdog_timeout() const = 0;
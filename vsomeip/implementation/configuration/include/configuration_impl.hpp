@@ -25,6 +25,7 @@
 #include "local_clients_keepalive.hpp"
 #include "service_instance_range.hpp"
 #include "trace.hpp"
+#include "tunnel.hpp"
 #include "../../e2e_protection/include/e2exf/config.hpp"
 #include "../../security/include/policy.hpp"
 #include "../../utility/include/service_instance_map.hpp"
@@ -128,6 +129,8 @@ public:
 
     VSOMEIP_EXPORT std::size_t get_max_dispatchers(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_max_dispatch_time(const std::string& _name) const;
+    VSOMEIP_EXPORT std::size_t get_dispatcher_threads(const std::string& _name) const;
+    VSOMEIP_EXPORT std::size_t get_message_pool_capacity(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_max_detached_thread_wait_time(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_io_thread_count(const std::string& _name) const;
     VSOMEIP_EXPORT int get_io_thread_nice_level(const std::string& _name) const;
@@ -187,6 +190,8 @@ public:
     // Trace configuration
     VSOMEIP_EXPORT std::shared_ptr<cfg::trace> get_trace() const;
 
+    VSOMEIP_EXPORT std::shared_ptr<cfg::tunnel> get_tunnel() const;
+
     VSOMEIP_EXPORT bool is_watchdog_enabled() const;
     VSOMEIP_EXPORT uint32_t get_watchdog_timeout() const;
     VSOMEIP_EXPORT uint32_t get_allowed_missing_pongs() const;
@@ -341,6 +346,7 @@ private:
     void load_eventgroup(std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
 
     void load_internal_services(const configuration_element& _element);
+    bool load_service_instance_range(const boost::property_tree::ptree& _tree, service_instance_range& _range) const;
 
     void load_clients(const configuration_element& _element);
     void load_client(const boost::property_tree::ptree& _tree);
@@ -349,6 +355,9 @@ private:
     std::pair<uint16_t, uint16_t> load_client_port_range(const boost::property_tree::ptree& _tree);
 
     void load_watchdog(const configuration_element& _element);
+    void load_tunnel(const configuration_element& _element);
+    void load_tunnel_lane(const boost::property_tree::ptree& _tree);
+    void load_tunnel_topic(const boost::property_tree::ptree& _tree);
     void load_local_clients_keepalive(const configuration_element& _element);
 
     void load_request_debounce_time(const configuration_element& _element);
@@ -492,6 +501,7 @@ protected:
     std::unordered_set<std::string> supported_selective_addresses;
 
     std::shared_ptr<watchdog> watchdog_;
+    std::shared_ptr<tunnel> tunnel_;
     std::shared_ptr<local_clients_keepalive> local_clients_keepalive_;
 
     std::vector<service_instance_range> internal_service_ranges_;
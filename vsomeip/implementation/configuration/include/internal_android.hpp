@@ -83,6 +83,25 @@
 
 #define VSOMEIP_DEFAULT_LOCAL_CLIENTS_KEEPALIVE_TIME    5000
 
+#define VSOMEIP_DEFAULT_TUNNEL_CYCLE_TIME               100
+#define VSOMEIP_DEFAULT_TUNNEL_SPIN_TIME                50
+#define VSOMEIP_DEFAULT_TUNNEL_MAX_THREAD_PUBLISHERS    8
+#define VSOMEIP_DEFAULT_TUNNEL_MAX_REQUESTS             1024
+#define VSOMEIP_DEFAULT_TUNNEL_REQUEST_TIMEOUT          5000
+#define VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_MESSAGES       32
+#define VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_BYTES          16384
+#define VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_DELAY          500
+#define VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE              20
+#define VSOMEIP_DEFAULT_TUNNEL_HISTORY_SIZE             20
+#define VSOMEIP_DEFAULT_TUNNEL_INITIAL_MAX_SLICE_LEN    1500
+#define VSOMEIP_DEFAULT_TUNNEL_STATS_INTERVAL           10000
+#define VSOMEIP_DEFAULT_TUNNEL_RESTART_GRACE            5000
+#define VSOMEIP_DEFAULT_TUNNEL_FIELD_CACHE_SLOTS        256
+#define VSOMEIP_DEFAULT_TUNNEL_EVENT_THROTTLE           100
+#define VSOMEIP_DEFAULT_TUNNEL_MAX_GATEWAYS             0
+#define VSOMEIP_DEFAULT_TUNNEL_TOPIC_BUFFER_SIZE        2
+#define VSOMEIP_DEFAULT_TUNNEL_TOPIC_HISTORY_SIZE       1
+
 #define VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE     1703936
 
 #define VSOMEIP_DEFAULT_IO_THREAD_COUNT         2
@@ -92,6 +111,11 @@
 
 #define VSOMEIP_DEFAULT_MAX_DISPATCH_TIME       100
 #define VSOMEIP_DEFAULT_MAX_DISPATCHERS         10
+#define VSOMEIP_DEFAULT_DISPATCHER_THREADS      0
+#define VSOMEIP_DEFAULT_MESSAGE_POOL_CAPACITY   0
+#define VSOMEIP_MESSAGE_POOL_MAX_BUFFER_SIZE    65536
+
+#define VSOMEIP_MIN_PAYLOAD_VIEW_SIZE           1024
 
 #define VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS  3
 
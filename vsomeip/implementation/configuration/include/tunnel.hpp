@@ -0,0 +1,99 @@
+// Copyright (C) 2014-2021 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CFG_TUNNEL_HPP_
+#define VSOMEIP_V3_CFG_TUNNEL_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+
+#include "service_instance_range.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+// One pair of iceoryx2 services between the tunnel and the gateway.
+// A maximum of 0 leaves the value to the tunnel (publishers) or iceoryx2 (subscribers, loans).
+struct tunnel_lane {
+    tunnel_lane() :
+        buffer_size_(VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE), history_size_(VSOMEIP_DEFAULT_TUNNEL_HISTORY_SIZE), is_safe_overflow_(true),
+        max_publishers_(0), max_subscribers_(0), max_loaned_samples_(0), initial_max_slice_len_(VSOMEIP_DEFAULT_TUNNEL_INITIAL_MAX_SLICE_LEN),
+        cpu_(-1) { }
+
+    std::string to_gateway_;
+    std::string from_gateway_;
+
+    uint64_t buffer_size_;
+    uint64_t history_size_;
+    bool is_safe_overflow_;
+    uint64_t max_publishers_;
+    uint64_t max_subscribers_;
+    uint64_t max_loaned_samples_;
+    uint64_t initial_max_slice_len_;
+
+    int cpu_;
+    std::vector<service_instance_range> services_;
+};
+
+// iceoryx2 publish-subscribe service of its own for one event, or for all events of an eventgroup,
+// of a service instance. Exactly one of event_ and eventgroup_ is set.
+struct tunnel_topic {
+    tunnel_topic() :
+        service_(0), instance_(0), event_(ANY_EVENT), eventgroup_(ANY_EVENTGROUP), buffer_size_(VSOMEIP_DEFAULT_TUNNEL_TOPIC_BUFFER_SIZE),
+        history_size_(VSOMEIP_DEFAULT_TUNNEL_TOPIC_HISTORY_SIZE) { }
+
+    std::string name_;
+    service_t service_;
+    instance_t instance_;
+    event_t event_;
+    eventgroup_t eventgroup_;
+
+    uint64_t buffer_size_;
+    uint64_t history_size_;
+};
+
+// Settings of the iceoryx2 tunnel example ("tunnel" section).
+struct tunnel {
+    tunnel() :
+        is_configured_(false), cycle_time_(VSOMEIP_DEFAULT_TUNNEL_CYCLE_TIME), spin_time_(VSOMEIP_DEFAULT_TUNNEL_SPIN_TIME),
+        max_thread_publishers_(VSOMEIP_DEFAULT_TUNNEL_MAX_THREAD_PUBLISHERS), max_requests_(VSOMEIP_DEFAULT_TUNNEL_MAX_REQUESTS),
+        request_timeout_(VSOMEIP_DEFAULT_TUNNEL_REQUEST_TIMEOUT), batch_max_messages_(VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_MESSAGES),
+        batch_max_bytes_(VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_BYTES), batch_max_delay_(VSOMEIP_DEFAULT_TUNNEL_BATCH_MAX_DELAY),
+        stats_interval_(VSOMEIP_DEFAULT_TUNNEL_STATS_INTERVAL), restart_grace_(VSOMEIP_DEFAULT_TUNNEL_RESTART_GRACE),
+        field_cache_slots_(VSOMEIP_DEFAULT_TUNNEL_FIELD_CACHE_SLOTS),
+        event_throttle_(VSOMEIP_DEFAULT_TUNNEL_EVENT_THROTTLE), max_gateways_(VSOMEIP_DEFAULT_TUNNEL_MAX_GATEWAYS), is_lane_hash_(false), control_lane_(-1), event_lane_(-1), request_lane_(-1) { }
+
+    bool is_configured_;
+
+    std::string wait_mode_;
+    uint32_t cycle_time_; // ms
+    uint32_t spin_time_; // us
+    uint32_t max_thread_publishers_;
+    uint32_t max_requests_;
+    uint32_t request_timeout_; // ms
+    uint32_t batch_max_messages_;
+    uint32_t batch_max_bytes_;
+    uint32_t batch_max_delay_; // us
+    uint32_t stats_interval_; // ms, 0: disabled
+    uint32_t restart_grace_; // ms, 0: no warm restart
+    uint32_t field_cache_slots_; // 0: no field cache
+    uint32_t event_throttle_; // ms, 0: no throttling of a congested lane
+    uint32_t max_gateways_; // 0: iceoryx2 defaults
+
+    bool is_lane_hash_;
+    int control_lane_;
+    int event_lane_;
+    int request_lane_;
+    std::vector<tunnel_lane> lanes_;
+    std::vector<tunnel_topic> topics_;
+};
+
+} // namespace cfg
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CFG_TUNNEL_HPP_
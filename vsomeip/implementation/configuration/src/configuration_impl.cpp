@@ -59,7 +59,7 @@ configuration_impl::configuration_impl(const std::string& _path) :
     sd_wait_route_netlink_notification_{VSOMEIP_SD_WAIT_ROUTE_NETLINK_NOTIFICATION}, max_configured_message_size_{0},
     max_local_message_size_{0}, max_reliable_message_size_{0}, max_unreliable_message_size_{0},
     buffer_shrink_threshold_{VSOMEIP_DEFAULT_BUFFER_SHRINK_THRESHOLD}, trace_{std::make_shared<trace>()},
-    watchdog_{std::make_shared<watchdog>()}, local_clients_keepalive_{std::make_shared<local_clients_keepalive>()}, log_version_{true},
+    watchdog_{std::make_shared<watchdog>()}, tunnel_{std::make_shared<tunnel>()}, local_clients_keepalive_{std::make_shared<local_clients_keepalive>()}, log_version_{true},
     log_version_interval_{VSOMEIP_DEFAULT_LOG_INTERVAL}, permissions_uds_{VSOMEIP_DEFAULT_UDS_PERMISSIONS}, network_{"vsomeip"},
     e2e_enabled_{false}, log_memory_{false}, log_memory_interval_{0}, log_status_{false}, log_status_interval_{0},
     endpoint_queue_limit_external_{QUEUE_SIZE_UNLIMITED}, endpoint_queue_limit_local_{QUEUE_SIZE_UNLIMITED},
@@ -146,6 +146,7 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     trace_ = std::make_shared<trace>(*_other.trace_);
     supported_selective_addresses = _other.supported_selective_addresses;
     watchdog_ = std::make_shared<watchdog>(*_other.watchdog_);
+    tunnel_ = std::make_shared<tunnel>(*_other.tunnel_);
     local_clients_keepalive_ = std::make_shared<local_clients_keepalive>(*_other.local_clients_keepalive_);
     internal_service_ranges_ = _other.internal_service_ranges_;
     log_version_ = _other.log_version_;
@@ -530,6 +531,7 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
             load_internal_services(e);
             load_clients(e);
             load_watchdog(e);
+            load_tunnel(e);
             load_selective_broadcasts_support(e);
             load_e2e(e);
             load_debounce(e);
@@ -898,6 +900,8 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
     client_t its_id(VSOMEIP_CLIENT_UNSET);
     std::size_t its_max_dispatchers(VSOMEIP_DEFAULT_MAX_DISPATCHERS);
     std::size_t its_max_dispatch_time(VSOMEIP_DEFAULT_MAX_DISPATCH_TIME);
+    std::size_t its_dispatcher_threads(VSOMEIP_DEFAULT_DISPATCHER_THREADS);
+    std::size_t its_message_pool_capacity(VSOMEIP_DEFAULT_MESSAGE_POOL_CAPACITY);
     std::size_t its_max_detached_thread_wait_time(VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS);
     std::size_t its_io_thread_count(VSOMEIP_DEFAULT_IO_THREAD_COUNT);
     std::size_t its_request_debounce_time(VSOMEIP_REQUEST_DEBOUNCE_TIME);
@@ -925,6 +929,16 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
         } else if (its_key == "max_dispatch_time") {
             its_converter << std::dec << its_value;
             its_converter >> its_max_dispatch_time;
+        } else if (its_key == "dispatcher_threads") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_dispatcher_threads;
+            if (its_dispatcher_threads > 255) {
+                VSOMEIP_WARNING << "Max. number of dispatcher threads per application is 255";
+                its_dispatcher_threads = 255;
+            }
+        } else if (its_key == "message_pool_capacity") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_message_pool_capacity;
         } else if (its_key == "max_detached_thread_wait_time") {
             its_converter << std::dec << its_value;
             its_converter >> its_max_detached_thread_wait_time;
@@ -988,7 +1002,9 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
                                        plugins,
                                        its_io_thread_nice_level,
                                        its_debounces,
-                                       has_session_handling};
+                                       has_session_handling,
+                                       its_dispatcher_threads,
+                                       its_message_pool_capacity};
         } else {
             VSOMEIP_WARNING << "Multiple configurations for application " << its_name << ". Ignoring a configuration from " << _file_name;
         }
@@ -2230,62 +2246,64 @@ void configuration_impl::load_internal_services(const configuration_element& _el
         auto its_internal_services = _element.tree_.get_child("internal_services");
         for (auto found_range = its_internal_services.begin(); found_range != its_internal_services.end(); ++found_range) {
             service_instance_range range;
-            range.first_service_ = 0x0;
-            range.last_service_ = 0x0;
-            range.first_instance_ = 0x0;
-            range.last_instance_ = 0xffff;
-            for (auto i = found_range->second.begin(); i != found_range->second.end(); ++i) {
-                if (i->first == "first") {
-                    if (i->second.size() == 0) {
-                        std::stringstream its_converter;
-                        std::string value = i->second.data();
-                        its_converter << std::hex << value;
-                        its_converter >> range.first_service_;
-                    }
-                    for (auto n = i->second.begin(); n != i->second.end(); ++n) {
-                        if (n->first == "service") {
-                            std::stringstream its_converter;
-                            std::string value = n->second.data();
-                            its_converter << std::hex << value;
-                            its_converter >> range.first_service_;
-                        } else if (n->first == "instance") {
-                            std::stringstream its_converter;
-                            std::string value = n->second.data();
-                            its_converter << std::hex << value;
-                            its_converter >> range.first_instance_;
-                        }
-                    }
-                } else if (i->first == "last") {
-                    if (i->second.size() == 0) {
-                        std::stringstream its_converter;
-                        std::string value = i->second.data();
-                        its_converter << std::hex << value;
-                        its_converter >> range.last_service_;
-                    }
-                    for (auto n = i->second.begin(); n != i->second.end(); ++n) {
-                        if (n->first == "service") {
-                            std::stringstream its_converter;
-                            std::string value = n->second.data();
-                            its_converter << std::hex << value;
-                            its_converter >> range.last_service_;
-                        } else if (n->first == "instance") {
-                            std::stringstream its_converter;
-                            std::string value = n->second.data();
-                            its_converter << std::hex << value;
-                            its_converter >> range.last_instance_;
-                        }
-                    }
+            if (load_service_instance_range(found_range->second, range)) {
+                internal_service_ranges_.push_back(range);
+            }
+        }
+    } catch (...) {
+        VSOMEIP_ERROR << "Error parsing internal service range configuration!";
+    }
+}
+
+bool configuration_impl::load_service_instance_range(const boost::property_tree::ptree& _tree, service_instance_range& _range) const {
+    _range.first_service_ = 0x0;
+    _range.last_service_ = 0x0;
+    _range.first_instance_ = 0x0;
+    _range.last_instance_ = 0xffff;
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        if (i->first == "first") {
+            if (i->second.size() == 0) {
+                std::stringstream its_converter;
+                std::string value = i->second.data();
+                its_converter << std::hex << value;
+                its_converter >> _range.first_service_;
+            }
+            for (auto n = i->second.begin(); n != i->second.end(); ++n) {
+                if (n->first == "service") {
+                    std::stringstream its_converter;
+                    std::string value = n->second.data();
+                    its_converter << std::hex << value;
+                    its_converter >> _range.first_service_;
+                } else if (n->first == "instance") {
+                    std::stringstream its_converter;
+                    std::string value = n->second.data();
+                    its_converter << std::hex << value;
+                    its_converter >> _range.first_instance_;
                 }
             }
-            if (range.last_service_ >= range.first_service_) {
-                if (range.last_instance_ >= range.first_instance_) {
-                    internal_service_ranges_.push_back(range);
+        } else if (i->first == "last") {
+            if (i->second.size() == 0) {
+                std::stringstream its_converter;
+                std::string value = i->second.data();
+                its_converter << std::hex << value;
+                its_converter >> _range.last_service_;
+            }
+            for (auto n = i->second.begin(); n != i->second.end(); ++n) {
+                if (n->first == "service") {
+                    std::stringstream its_converter;
+                    std::string value = n->second.data();
+                    its_converter << std::hex << value;
+                    its_converter >> _range.last_service_;
+                } else if (n->first == "instance") {
+                    std::stringstream its_converter;
+                    std::string value = n->second.data();
+                    its_converter << std::hex << value;
+                    its_converter >> _range.last_instance_;
                 }
             }
         }
-    } catch (...) {
-        VSOMEIP_ERROR << "Error parsing internal service range configuration!";
     }
+    return _range.last_service_ >= _range.first_service_ && _range.last_instance_ >= _range.first_instance_;
 }
 
 void configuration_impl::load_clients(const configuration_element& _element) {
@@ -2442,6 +2460,183 @@ void configuration_impl::load_watchdog(const configuration_element& _element) {
     }
 }
 
+void configuration_impl::load_tunnel(const configuration_element& _element) {
+    try {
+        auto its_tunnel = _element.tree_.get_child_optional("tunnel");
+        if (!its_tunnel) {
+            return;
+        }
+        if (tunnel_->is_configured_) {
+            VSOMEIP_WARNING << "Multiple definitions of tunnel. Ignoring definition from " << _element.name_;
+            return;
+        }
+
+        for (auto i = its_tunnel->begin(); i != its_tunnel->end(); ++i) {
+            std::string its_key(i->first);
+            std::string its_value(i->second.data());
+            std::stringstream its_converter;
+            its_converter << std::dec << its_value;
+
+            if (its_key == "wait_mode") {
+                tunnel_->wait_mode_ = its_value;
+            } else if (its_key == "cycle_time") {
+                its_converter >> tunnel_->cycle_time_;
+            } else if (its_key == "spin_time") {
+                its_converter >> tunnel_->spin_time_;
+            } else if (its_key == "max_thread_publishers") {
+                its_converter >> tunnel_->max_thread_publishers_;
+            } else if (its_key == "max_requests") {
+                its_converter >> tunnel_->max_requests_;
+            } else if (its_key == "request_timeout") {
+                its_converter >> tunnel_->request_timeout_;
+            } else if (its_key == "stats_interval") {
+                its_converter >> tunnel_->stats_interval_;
+            } else if (its_key == "restart_grace") {
+                its_converter >> tunnel_->restart_grace_;
+            } else if (its_key == "field_cache") {
+                its_converter >> tunnel_->field_cache_slots_;
+            } else if (its_key == "event_throttle") {
+                its_converter >> tunnel_->event_throttle_;
+            } else if (its_key == "max_gateways") {
+                its_converter >> tunnel_->max_gateways_;
+            } else if (its_key == "batch") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    std::stringstream its_batch_converter;
+                    its_batch_converter << std::dec << j->second.data();
+                    if (j->first == "max_messages") {
+                        its_batch_converter >> tunnel_->batch_max_messages_;
+                    } else if (j->first == "max_bytes") {
+                        its_batch_converter >> tunnel_->batch_max_bytes_;
+                    } else if (j->first == "max_delay") {
+                        its_batch_converter >> tunnel_->batch_max_delay_;
+                    }
+                }
+            } else if (its_key == "lane_hash") {
+                tunnel_->is_lane_hash_ = (its_value == "true");
+            } else if (its_key == "classes") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    std::stringstream its_class_converter;
+                    its_class_converter << std::dec << j->second.data();
+                    if (j->first == "control") {
+                        its_class_converter >> tunnel_->control_lane_;
+                    } else if (j->first == "event") {
+                        its_class_converter >> tunnel_->event_lane_;
+                    } else if (j->first == "request") {
+                        its_class_converter >> tunnel_->request_lane_;
+                    }
+                }
+            } else if (its_key == "lanes") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    load_tunnel_lane(j->second);
+                }
+            } else if (its_key == "topics") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    load_tunnel_topic(j->second);
+                }
+            }
+        }
+
+        if (tunnel_->lanes_.empty()) {
+            tunnel_->lanes_.emplace_back();
+        }
+        tunnel_->is_configured_ = true;
+    } catch (...) {
+        VSOMEIP_ERROR << "Error parsing tunnel configuration!";
+    }
+}
+
+void configuration_impl::load_tunnel_lane(const boost::property_tree::ptree& _tree) {
+    tunnel_lane its_lane;
+
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+        its_converter << std::dec << its_value;
+
+        if (its_key == "to_gateway") {
+            its_lane.to_gateway_ = its_value;
+        } else if (its_key == "from_gateway") {
+            its_lane.from_gateway_ = its_value;
+        } else if (its_key == "subscriber_max_buffer_size") {
+            its_converter >> its_lane.buffer_size_;
+        } else if (its_key == "history_size") {
+            its_converter >> its_lane.history_size_;
+        } else if (its_key == "safe_overflow") {
+            its_lane.is_safe_overflow_ = (its_value == "true");
+        } else if (its_key == "max_publishers") {
+            its_converter >> its_lane.max_publishers_;
+        } else if (its_key == "max_subscribers") {
+            its_converter >> its_lane.max_subscribers_;
+        } else if (its_key == "max_loaned_samples") {
+            its_converter >> its_lane.max_loaned_samples_;
+        } else if (its_key == "initial_max_slice_len") {
+            its_converter >> its_lane.initial_max_slice_len_;
+        } else if (its_key == "cpu") {
+            its_converter >> its_lane.cpu_;
+        } else if (its_key == "services") {
+            for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                service_instance_range its_range;
+                if (load_service_instance_range(j->second, its_range)) {
+                    its_lane.services_.push_back(its_range);
+                } else {
+                    VSOMEIP_WARNING << "Ignoring invalid service range of tunnel lane " << tunnel_->lanes_.size();
+                }
+            }
+        }
+    }
+
+    if (its_lane.buffer_size_ == 0) {
+        VSOMEIP_WARNING << "Invalid subscriber_max_buffer_size 0 of tunnel lane " << tunnel_->lanes_.size() << ", using "
+                        << VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE;
+        its_lane.buffer_size_ = VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE;
+    }
+    tunnel_->lanes_.push_back(its_lane);
+}
+
+void configuration_impl::load_tunnel_topic(const boost::property_tree::ptree& _tree) {
+    tunnel_topic its_topic;
+
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+
+        if (its_key == "name") {
+            its_topic.name_ = its_value;
+        } else if (its_key == "service") {
+            its_converter << std::hex << its_value;
+            its_converter >> its_topic.service_;
+        } else if (its_key == "instance") {
+            its_converter << std::hex << its_value;
+            its_converter >> its_topic.instance_;
+        } else if (its_key == "event") {
+            its_converter << std::hex << its_value;
+            its_converter >> its_topic.event_;
+        } else if (its_key == "eventgroup") {
+            its_converter << std::hex << its_value;
+            its_converter >> its_topic.eventgroup_;
+        } else if (its_key == "subscriber_max_buffer_size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_topic.buffer_size_;
+        } else if (its_key == "history_size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_topic.history_size_;
+        }
+    }
+
+    if (its_topic.name_.empty() || (its_topic.event_ == ANY_EVENT) == (its_topic.eventgroup_ == ANY_EVENTGROUP)) {
+        VSOMEIP_WARNING << "Ignoring tunnel topic " << tunnel_->topics_.size() << ", it needs a name and either an event or an eventgroup";
+        return;
+    }
+    if (its_topic.buffer_size_ == 0) {
+        VSOMEIP_WARNING << "Invalid subscriber_max_buffer_size 0 of tunnel topic " << its_topic.name_ << ", using "
+                        << VSOMEIP_DEFAULT_TUNNEL_TOPIC_BUFFER_SIZE;
+        its_topic.buffer_size_ = VSOMEIP_DEFAULT_TUNNEL_TOPIC_BUFFER_SIZE;
+    }
+    tunnel_->topics_.push_back(its_topic);
+}
+
 void configuration_impl::load_local_clients_keepalive(const configuration_element& _element) {
     try {
         auto its_service_discovery = _element.tree_.get_child("local-clients-keepalive");
@@ -3132,6 +3327,24 @@ std::size_t configuration_impl::get_max_dispatchers(const std::string& _name) co
     return its_max_dispatchers;
 }
 
+std::size_t configuration_impl::get_dispatcher_threads(const std::string& _name) const {
+    std::size_t its_dispatcher_threads{VSOMEIP_DEFAULT_DISPATCHER_THREADS};
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        its_dispatcher_threads = found_application->second.dispatcher_threads_;
+    }
+    return its_dispatcher_threads;
+}
+
+std::size_t configuration_impl::get_message_pool_capacity(const std::string& _name) const {
+    std::size_t its_message_pool_capacity{VSOMEIP_DEFAULT_MESSAGE_POOL_CAPACITY};
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        its_message_pool_capacity = found_application->second.message_pool_capacity_;
+    }
+    return its_message_pool_capacity;
+}
+
 std::size_t configuration_impl::get_max_dispatch_time(const std::string& _name) const {
     size_t its_max_dispatch_time{default_max_dispatch_time_};
     auto found_application = applications_.find(_name);
@@ -3605,6 +3818,10 @@ std::shared_ptr<cfg::trace> configuration_impl::get_trace() const {
 }
 
 // Watchdog config
+std::shared_ptr<cfg::tunnel> configuration_impl::get_tunnel() const {
+    return tunnel_;
+}
+
 bool configuration_impl::is_watchdog_enabled() const {
     return watchdog_->is_enabeled_;
 }
@@ -35,6 +35,8 @@ public:
     virtual bool is_closed() const = 0;
 
     virtual bool send(const byte_t* _data, uint32_t _size) = 0;
+    // Sends _cmd_header followed by the _size bytes at _data as one message
+    virtual bool send(const std::vector<byte_t>& _cmd_header, const byte_t* _data, uint32_t _size) = 0;
     virtual bool send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) = 0;
     virtual bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) = 0;
     virtual void enable_magic_cookies() = 0;
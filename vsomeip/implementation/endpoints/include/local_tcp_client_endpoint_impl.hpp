@@ -38,6 +38,7 @@ public:
     // this overrides client_endpoint_impl::send to disable the pull method
     // for local communication
     bool send(const uint8_t* _data, uint32_t _size);
+    bool send(const std::vector<byte_t>& _cmd_header, const byte_t* _data, uint32_t _size);
     void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
                                             std::chrono::nanoseconds* _maximum_retention) const;
 
@@ -53,6 +54,7 @@ private:
     std::string get_remote_information() const;
     bool check_packetizer_space(std::uint32_t _size) const;
     bool queue_train_buffer(std::uint32_t _size);
+    bool enqueue(const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size);
     std::uint32_t get_max_allowed_reconnects() const;
     void max_allowed_reconnects_reached();
 
@@ -17,6 +17,7 @@
 
 #include "buffer.hpp"
 #include "server_endpoint_impl.hpp"
+#include "../../message/include/receive_buffer_lender.hpp"
 
 namespace vsomeip_v3 {
 
@@ -119,6 +120,7 @@ private:
         const std::uint32_t max_message_size_;
 
         message_buffer_t recv_buffer_;
+        receive_buffer_lender recv_buffer_lender_;
         size_t recv_buffer_size_;
         std::uint32_t missing_capacity_;
         std::uint32_t shrink_count_;
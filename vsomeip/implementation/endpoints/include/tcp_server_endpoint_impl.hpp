@@ -14,6 +14,7 @@
 #include <vsomeip/defines.hpp>
 #include <vsomeip/export.hpp>
 #include "server_endpoint_impl.hpp"
+#include "../../message/include/receive_buffer_lender.hpp"
 
 #include <chrono>
 
@@ -112,6 +113,7 @@ private:
         const uint32_t recv_buffer_size_initial_;
 
         message_buffer_t recv_buffer_;
+        receive_buffer_lender recv_buffer_lender_;
         size_t recv_buffer_size_;
         std::uint32_t missing_capacity_;
         std::uint32_t shrink_count_;
@@ -11,6 +11,7 @@
 
 #include "server_endpoint_impl.hpp"
 #include "tp_reassembler.hpp"
+#include "../../message/include/receive_buffer_lender.hpp"
 
 namespace vsomeip_v3 {
 using udp_server_endpoint_base_impl = server_endpoint_impl<boost::asio::ip::udp>;
@@ -114,10 +115,12 @@ private:
     std::shared_ptr<socket_type> unicast_socket_;
     endpoint_type unicast_remote_;
     message_buffer_t unicast_recv_buffer_;
+    receive_buffer_lender unicast_recv_buffer_lender_;
 
     std::shared_ptr<socket_type> multicast_socket_;
     std::unique_ptr<endpoint_type> multicast_local_;
     message_buffer_t multicast_recv_buffer_;
+    receive_buffer_lender multicast_recv_buffer_lender_;
     std::atomic<unsigned> lifecycle_idx_;
     std::map<std::string, bool, std::less<>> joined_;
     std::map<std::string, bool, std::less<>> join_status_;
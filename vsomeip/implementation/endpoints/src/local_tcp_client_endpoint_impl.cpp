@@ -222,17 +222,6 @@ void local_tcp_client_endpoint_impl::receive() {
 // this overrides client_endpoint_impl::send to disable the pull method
 // for local communication
 bool local_tcp_client_endpoint_impl::send(const uint8_t* _data, uint32_t _size) {
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
-
-    if (endpoint_impl::sending_blocked_ || !check_queue_limit(_data, _size)) {
-        return false;
-    }
-    if (!check_message_size(_size)) {
-        return false;
-    }
-    if (!check_packetizer_space(_size)) {
-        return false;
-    }
 #if 0
     std::stringstream msg;
     msg << "lce::send: ";
@@ -241,7 +230,33 @@ bool local_tcp_client_endpoint_impl::send(const uint8_t* _data, uint32_t _size)
             << static_cast<int>(_data[i]) << " ";
     VSOMEIP_INFO << msg.str();
 #endif
-    queue_train_buffer(_size);
+    return enqueue(nullptr, 0, _data, _size);
+}
+
+bool local_tcp_client_endpoint_impl::send(const std::vector<byte_t>& _cmd_header, const byte_t* _data, uint32_t _size) {
+    return enqueue(_cmd_header.data(), static_cast<uint32_t>(_cmd_header.size()), _data, _size);
+}
+
+bool local_tcp_client_endpoint_impl::enqueue(const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size) {
+    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+
+    const uint32_t its_size{_header_size + _size};
+    if (its_size < _size) {
+        return false;
+    }
+    if (endpoint_impl::sending_blocked_ || !check_queue_limit(_header_size > 0 ? _header : _data, its_size)) {
+        return false;
+    }
+    if (!check_message_size(its_size)) {
+        return false;
+    }
+    if (!check_packetizer_space(its_size)) {
+        return false;
+    }
+    queue_train_buffer(its_size);
+    // The only copy of the message, its parts are joined while queuing it
+    train_->buffer_->reserve(train_->buffer_->size() + its_size);
+    train_->buffer_->insert(train_->buffer_->end(), _header, _header + _header_size);
     train_->buffer_->insert(train_->buffer_->end(), _data, _data + _size);
     queue_train(train_);
     train_->buffer_ = std::make_shared<message_buffer_t>();
@@ -550,6 +550,8 @@ void local_uds_server_endpoint_impl::connection::receive_cbk(boost::system::erro
         }
         recv_buffer_size_ += _bytes;
 
+        // Payloads of the messages passed to the host may reference the buffer
+        receive_buffer_lender::scope its_lending(recv_buffer_lender_, recv_buffer_, recv_buffer_size_);
         bool message_is_empty(false);
         bool found_message(false);
 
@@ -586,6 +588,7 @@ void local_uds_server_endpoint_impl::connection::receive_cbk(boost::system::erro
                     VSOMEIP_ERROR << "Received a local message which exceeds "
                                   << "maximum message size (" << std::dec << its_command_size << ") aborting! local: " << get_path_local()
                                   << " remote: " << get_path_remote();
+                    its_lending.reclaim(0, 0);
                     recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
                     recv_buffer_.shrink_to_fit();
                     return;
@@ -706,8 +709,11 @@ void local_uds_server_endpoint_impl::connection::receive_cbk(boost::system::erro
                 if (its_iteration_gap) {
                     // Message not complete and not in front of the buffer!
                     // Copy last part to front for consume in future receive_cbk call!
-                    for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                        recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
+                    // Reclaiming copies it to a spare buffer if the buffer is still referenced
+                    if (!its_lending.reclaim(its_iteration_gap, recv_buffer_size_)) {
+                        for (size_t i = 0; i < recv_buffer_size_; ++i) {
+                            recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
+                        }
                     }
                     // Still more capacity needed after shifting everything to front?
                     if (missing_capacity_ && missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
@@ -211,10 +211,11 @@ server_endpoint_impl<Protocol>::to_clients_key(service_t its_service, method_t i
 
 template<typename Protocol>
 bool server_endpoint_impl<Protocol>::send(const std::vector<byte_t>& _cmd_header, const byte_t* _data, uint32_t _size) {
-    (void)_cmd_header;
-    (void)_data;
-    (void)_size;
-    return false;
+    std::vector<byte_t> its_buffer;
+    its_buffer.reserve(_cmd_header.size() + _size);
+    its_buffer.insert(its_buffer.end(), _cmd_header.begin(), _cmd_header.end());
+    its_buffer.insert(its_buffer.end(), _data, _data + _size);
+    return send(its_buffer.data(), static_cast<uint32_t>(its_buffer.size()));
 }
 
 template<typename Protocol>
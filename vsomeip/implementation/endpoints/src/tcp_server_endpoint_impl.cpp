@@ -497,6 +497,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
             }
             recv_buffer_size_ += _bytes;
 
+            // Payloads of the messages passed to the host may reference the buffer
+            receive_buffer_lender::scope its_lending(recv_buffer_lender_, recv_buffer_, recv_buffer_size_);
             size_t its_iteration_gap = 0;
             bool has_full_message;
             do {
@@ -632,6 +634,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         return;
                     } else if (max_message_size_ != MESSAGE_SIZE_UNLIMITED && current_message_size > max_message_size_) {
                         recv_buffer_size_ = 0;
+                        its_lending.reclaim(0, 0);
                         recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
                         recv_buffer_.shrink_to_fit();
                         if (magic_cookies_enabled_) {
@@ -661,6 +664,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
                         recv_buffer_size_ = 0;
+                        its_lending.reclaim(0, 0);
                         recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
                         recv_buffer_.shrink_to_fit();
                         missing_capacity_ = 0;
@@ -685,9 +689,12 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                 }
             } while (has_full_message && recv_buffer_size_);
             if (its_iteration_gap) {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                    recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
+                // Copy incomplete message to front for next receive_cbk iteration,
+                // reclaiming copies it to a spare buffer if the buffer is still referenced
+                if (!its_lending.reclaim(its_iteration_gap, recv_buffer_size_)) {
+                    for (size_t i = 0; i < recv_buffer_size_; ++i) {
+                        recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
+                    }
                 }
                 // Still more capacity needed after shifting everything to front?
                 if (missing_capacity_ && missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
@@ -558,7 +558,10 @@ void udp_server_endpoint_impl::on_unicast_received(boost::system::error_code con
     if (_error) {
         VSOMEIP_ERROR << instance_name_ << "on_unicast_received: " << _error.message();
     } else {
+        // Payloads of the messages passed to the host may reference the buffer until the next receive
+        receive_buffer_lender::scope its_lending(unicast_recv_buffer_lender_, unicast_recv_buffer_);
         on_message_received_unlocked(_error, _bytes, false, unicast_remote_, unicast_recv_buffer_);
+        its_lending.reclaim(0, 0);
     }
 }
 
@@ -583,7 +586,9 @@ void udp_server_endpoint_impl::on_multicast_received(boost::system::error_code c
 
         if (!own_message) {
             if (own_subnet) {
+                receive_buffer_lender::scope its_lending(multicast_recv_buffer_lender_, multicast_recv_buffer_);
                 on_message_received_unlocked(_error, _bytes, true, _sender, multicast_recv_buffer_);
+                its_lending.reclaim(0, 0);
             }
         } else if (own_callback) {
             own_callback(&multicast_recv_buffer_[0], static_cast<uint32_t>(_bytes), boost::asio::ip::address());
@@ -6,6 +6,7 @@
 #ifndef VSOMEIP_V3_DESERIALIZER_HPP
 #define VSOMEIP_V3_DESERIALIZER_HPP
 
+#include <memory>
 #include <vector>
 
 #include <vsomeip/export.hpp>
@@ -36,7 +37,10 @@ public:
     VSOMEIP_EXPORT void set_remaining(std::size_t _remaining);
 
     // to be used by applications to deserialize a message
-    VSOMEIP_EXPORT message_impl* deserialize_message();
+    VSOMEIP_EXPORT std::shared_ptr<message_impl> deserialize_message();
+    // to be used by the routing to deserialize a received message, its payload
+    // references the receive buffer if that is lent (see receive_buffer_lender)
+    VSOMEIP_EXPORT std::shared_ptr<message_impl> deserialize_message(const byte_t* _data, std::size_t _length);
 
     // to be used (internally) by objects to deserialize their members
     // Note: this needs to be encapsulated!
@@ -46,6 +50,7 @@ public:
     VSOMEIP_EXPORT bool deserialize(uint8_t* _data, std::size_t _length);
     VSOMEIP_EXPORT bool deserialize(std::string& _target, std::size_t _length);
     VSOMEIP_EXPORT bool deserialize(std::vector<uint8_t>& _value);
+    VSOMEIP_EXPORT bool deserialize(std::vector<uint8_t>& _value, std::size_t _length);
 
     VSOMEIP_EXPORT bool look_ahead(std::size_t _index, uint8_t& _value) const;
     VSOMEIP_EXPORT bool look_ahead(std::size_t _index, uint16_t& _value) const;
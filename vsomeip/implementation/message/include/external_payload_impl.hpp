@@ -0,0 +1,66 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_EXTERNAL_PAYLOAD_IMPL_HPP
+#define VSOMEIP_V3_EXTERNAL_PAYLOAD_IMPL_HPP
+
+#include <memory>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/payload.hpp>
+
+namespace vsomeip_v3 {
+
+class serializer;
+class deserializer;
+
+// Payload referencing memory it does not own (e.g. a shared memory sample).
+// The memory is kept alive by the optional owner handle. All read accessors
+// work on the referenced memory directly; the first modifying access copies
+// the content into an internal buffer (copy-on-write), so the referenced
+// memory is never written.
+//
+// A writable payload instead modifies the referenced memory in place until its
+// size changes. This is used for slices of receive buffers, that belong to the
+// payload alone.
+class external_payload_impl : public payload {
+public:
+    VSOMEIP_EXPORT external_payload_impl(const byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner);
+    VSOMEIP_EXPORT external_payload_impl(byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner, bool _is_writable);
+    VSOMEIP_EXPORT virtual ~external_payload_impl() = default;
+
+    VSOMEIP_EXPORT bool operator==(const payload& _other);
+
+    VSOMEIP_EXPORT byte_t* get_data();
+    VSOMEIP_EXPORT const byte_t* get_data() const;
+    VSOMEIP_EXPORT length_t get_length() const;
+
+    VSOMEIP_EXPORT void set_capacity(length_t _capacity);
+
+    VSOMEIP_EXPORT void set_data(const byte_t* _data, length_t _length);
+    VSOMEIP_EXPORT void set_data(const std::vector<byte_t>& _data);
+    VSOMEIP_EXPORT void set_data(std::vector<byte_t>&& _data);
+
+    VSOMEIP_EXPORT bool serialize(serializer* _to) const;
+    VSOMEIP_EXPORT bool deserialize(deserializer* _from);
+
+    VSOMEIP_EXPORT bool is_external() const;
+
+private:
+    void detach();
+
+    const byte_t* external_data_;
+    byte_t* writable_data_;
+    length_t external_length_;
+    std::shared_ptr<void> owner_;
+
+    bool is_external_;
+    std::vector<byte_t> data_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_EXTERNAL_PAYLOAD_IMPL_HPP
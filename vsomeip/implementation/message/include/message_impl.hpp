@@ -40,6 +40,9 @@ public:
 
     VSOMEIP_EXPORT bool serialize(serializer* _to) const;
     VSOMEIP_EXPORT bool deserialize(deserializer* _from);
+    // Deserializes the header only, the payload references the first bytes of the
+    // _length bytes at _data
+    VSOMEIP_EXPORT bool deserialize(deserializer* _from, byte_t* _data, length_t _length, std::shared_ptr<void> _owner);
 
     VSOMEIP_EXPORT uint8_t get_check_result() const;
     VSOMEIP_EXPORT void set_check_result(uint8_t _check_result);
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_MESSAGE_POOL_HPP_
+#define VSOMEIP_V3_MESSAGE_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../utility/include/free_list.hpp"
+
+namespace vsomeip_v3 {
+
+class external_payload_impl;
+class message_impl;
+class payload_impl;
+
+// Recycles the memory of messages and payloads and the buffers of payloads.
+//
+// Free items of each kind are kept in a free_list with batches of get_capacity()
+// items, taking and returning them does not lock. Items which are created on the
+// receiving thread and dropped on a dispatcher thread go round in these batches.
+// A capacity of 0, the default, disables the pool.
+class message_pool {
+public:
+    VSOMEIP_EXPORT static void set_capacity(std::size_t _capacity);
+    VSOMEIP_EXPORT static std::size_t get_capacity();
+
+    VSOMEIP_EXPORT static std::shared_ptr<message_impl> create_message();
+    VSOMEIP_EXPORT static std::shared_ptr<payload_impl> create_payload();
+    // Writable payload referencing memory that is kept alive by _owner
+    VSOMEIP_EXPORT static std::shared_ptr<external_payload_impl> create_payload_view(byte_t* _data, length_t _length,
+                                                                                     std::shared_ptr<void> _owner);
+
+    // Empty buffer, that keeps the capacity it had when it was released
+    VSOMEIP_EXPORT static std::vector<byte_t> acquire_buffer();
+    VSOMEIP_EXPORT static void release_buffer(std::vector<byte_t>&& _buffer);
+
+private:
+    static std::atomic<std::size_t> capacity_;
+};
+
+namespace detail {
+
+template<std::size_t Size_>
+struct block_dispose {
+    void operator()(void*&& _block) const { ::operator delete(_block); }
+};
+
+// Memory blocks of Size_ bytes
+template<std::size_t Size_>
+free_list<void*, block_dispose<Size_>>& blocks() {
+    // Never destroyed, blocks may be returned by static destructors
+    static auto* its_blocks = new free_list<void*, block_dispose<Size_>>;
+    return *its_blocks;
+}
+
+// Allocator for std::allocate_shared, the block holding the control block and
+// the object is reused for the next object of the same type.
+template<class T_>
+class pool_allocator {
+public:
+    using value_type = T_;
+
+    pool_allocator() = default;
+    template<class U_>
+    pool_allocator(const pool_allocator<U_>&) { }
+
+    T_* allocate(std::size_t _n) {
+        static_assert(alignof(T_) <= alignof(std::max_align_t), "over-aligned types are not pooled");
+        if (_n == 1 && message_pool::get_capacity() != 0) {
+            if (void* its_block = blocks<sizeof(T_)>().acquire()) {
+                return static_cast<T_*>(its_block);
+            }
+        }
+        return static_cast<T_*>(::operator new(_n * sizeof(T_)));
+    }
+
+    void deallocate(T_* _p, std::size_t _n) {
+        if (_n == 1) {
+            blocks<sizeof(T_)>().release(static_cast<void*>(_p), message_pool::get_capacity());
+        } else {
+            ::operator delete(_p);
+        }
+    }
+
+    template<class U_>
+    bool operator==(const pool_allocator<U_>&) const {
+        return true;
+    }
+    template<class U_>
+    bool operator!=(const pool_allocator<U_>&) const {
+        return false;
+    }
+};
+
+} // namespace detail
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_MESSAGE_POOL_HPP_
@@ -24,7 +24,7 @@ public:
     VSOMEIP_EXPORT payload_impl(const byte_t* _data, uint32_t _size);
     VSOMEIP_EXPORT payload_impl(const std::vector<byte_t>& _data);
     VSOMEIP_EXPORT payload_impl(const payload_impl& _payload);
-    VSOMEIP_EXPORT virtual ~payload_impl() = default;
+    VSOMEIP_EXPORT virtual ~payload_impl();
 
     VSOMEIP_EXPORT bool operator==(const payload& _other);
 
@@ -43,6 +43,10 @@ public:
 
 private:
     std::vector<byte_t> data_;
+    // Length set by set_capacity() for the next deserialize(), a reused buffer may have a
+    // larger capacity. 0 is a valid length, has_capacity_ tells whether it was set.
+    length_t capacity_;
+    bool has_capacity_;
 };
 
 } // namespace vsomeip_v3
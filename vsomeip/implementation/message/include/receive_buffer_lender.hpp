@@ -0,0 +1,92 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_RECEIVE_BUFFER_LENDER_HPP_
+#define VSOMEIP_V3_RECEIVE_BUFFER_LENDER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+// Lends the receive buffer of an endpoint to the payloads of the messages it holds.
+//
+// While an endpoint hands the messages of its buffer to the routing host, it keeps a scope
+// open. Messages that are deserialized meanwhile on the same thread reference their payloads
+// in the buffer instead of copying them (see deserializer::deserialize_message). Before the
+// endpoint writes to the buffer again, it reclaims it: if any of these payloads is still
+// alive, it keeps the memory and the endpoint continues with a spare buffer. The memory is
+// given back to the spares of the endpoint when the last payload referencing it is gone.
+//
+// To bound the memory held by payloads, a buffer is only lent for views of at least a
+// max_view_ratio_ part of it and while less than max_lent_ buffers are referenced, else
+// the payload is copied.
+class receive_buffer_lender {
+public:
+    class scope {
+    public:
+        // _remainder is the number of bytes at the front of the buffer that are still to be
+        // consumed when the scope ends. Without it, nothing is kept.
+        VSOMEIP_EXPORT scope(receive_buffer_lender& _lender, std::vector<byte_t>& _buffer);
+        VSOMEIP_EXPORT scope(receive_buffer_lender& _lender, std::vector<byte_t>& _buffer, const std::size_t& _remainder);
+        VSOMEIP_EXPORT ~scope();
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+        // Makes the buffer writable again. If payloads still reference it, the buffer is
+        // replaced by a spare of the same size that starts with the _length bytes found at
+        // _offset, and true is returned. Otherwise the buffer is left as it is.
+        VSOMEIP_EXPORT bool reclaim(std::size_t _offset, std::size_t _length);
+
+    private:
+        friend class receive_buffer_lender;
+
+        receive_buffer_lender& lender_;
+        std::vector<byte_t>& buffer_;
+        const std::size_t* remainder_;
+        scope* previous_;
+    };
+
+    VSOMEIP_EXPORT receive_buffer_lender();
+
+    // Returns the owner of the _length bytes at _data if they lie in the buffer of a scope
+    // of the calling thread and sets _view to their writable address. Returns nullptr else.
+    VSOMEIP_EXPORT static std::shared_ptr<void> lend(const byte_t* _data, std::size_t _length, byte_t*& _view);
+
+private:
+    struct spares {
+        std::mutex mutex_;
+        std::vector<std::vector<byte_t>> buffers_;
+        // Buffers referenced by payloads, including the current one
+        std::atomic<std::size_t> lent_count_{0};
+    };
+
+    struct give_back {
+        void operator()(std::vector<byte_t>* _buffer) const;
+
+        std::weak_ptr<spares> spares_;
+    };
+
+    std::vector<byte_t> take_spare();
+
+    // Owner handed out to the payloads of the current buffer, created on first use
+    std::shared_ptr<std::vector<byte_t>> lent_;
+    std::shared_ptr<spares> spares_;
+
+    static constexpr std::size_t max_spares_{4};
+    static constexpr std::size_t max_lent_{4};
+    static constexpr std::size_t max_view_ratio_{16};
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_RECEIVE_BUFFER_LENDER_HPP_
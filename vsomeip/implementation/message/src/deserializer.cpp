@@ -9,11 +9,19 @@
 #include <iomanip>
 #include <sstream>
 #endif
+#include <vsomeip/defines.hpp>
 #include <vsomeip/internal/logger.hpp>
 
 #include "../include/message_impl.hpp"
 #include "../include/deserializer.hpp"
+#include "../include/message_pool.hpp"
+#include "../include/receive_buffer_lender.hpp"
 #include "../../utility/include/bithelper.hpp"
+#ifdef ANDROID
+#include "../../configuration/include/internal_android.hpp"
+#else
+#include "../../configuration/include/internal.hpp"
+#endif
 
 namespace vsomeip_v3 {
 
@@ -120,6 +128,17 @@ bool deserializer::deserialize(std::vector<uint8_t>& _value) {
     return true;
 }
 
+bool deserializer::deserialize(std::vector<uint8_t>& _value, std::size_t _length) {
+    if (_length > remaining_)
+        return false;
+
+    _value.assign(position_, position_ + static_cast<std::vector<byte_t>::difference_type>(_length));
+    position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    remaining_ -= _length;
+
+    return true;
+}
+
 bool deserializer::look_ahead(std::size_t _index, uint8_t& _value) const {
     if (_index > remaining_)
         return false;
@@ -149,14 +168,41 @@ bool deserializer::look_ahead(std::size_t _index, uint32_t& _value) const {
     return true;
 }
 
-message_impl* deserializer::deserialize_message() try {
-    std::unique_ptr<message_impl> deserialized_message = std::make_unique<message_impl>();
+std::shared_ptr<message_impl> deserializer::deserialize_message() try {
+    std::shared_ptr<message_impl> deserialized_message = message_pool::create_message();
     if (false == deserialized_message->deserialize(this)) {
         VSOMEIP_ERROR << "SOME/IP message deserialization failed!";
         deserialized_message = nullptr;
     }
 
-    return deserialized_message.release();
+    return deserialized_message;
+} catch (const std::exception& e) {
+    VSOMEIP_ERROR << "SOME/IP message deserialization failed with exception: " << e.what();
+    return nullptr;
+}
+
+std::shared_ptr<message_impl> deserializer::deserialize_message(const byte_t* _data, std::size_t _length) try {
+    byte_t* its_view{nullptr};
+    std::shared_ptr<void> its_owner;
+    if (_length >= VSOMEIP_FULL_HEADER_SIZE + VSOMEIP_MIN_PAYLOAD_VIEW_SIZE) {
+        its_owner = receive_buffer_lender::lend(_data, _length, its_view);
+    }
+    if (!its_owner) {
+        set_data(_data, _length);
+        return deserialize_message();
+    }
+
+    // Only the header is copied
+    set_data(_data, VSOMEIP_FULL_HEADER_SIZE);
+    std::shared_ptr<message_impl> deserialized_message = message_pool::create_message();
+    if (false
+        == deserialized_message->deserialize(this, its_view + VSOMEIP_FULL_HEADER_SIZE,
+                                             static_cast<length_t>(_length - VSOMEIP_FULL_HEADER_SIZE), std::move(its_owner))) {
+        VSOMEIP_ERROR << "SOME/IP message deserialization failed!";
+        deserialized_message = nullptr;
+    }
+
+    return deserialized_message;
 } catch (const std::exception& e) {
     VSOMEIP_ERROR << "SOME/IP message deserialization failed with exception: " << e.what();
     return nullptr;
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstring>
+
+#include "../include/deserializer.hpp"
+#include "../include/external_payload_impl.hpp"
+#include "../include/serializer.hpp"
+
+namespace vsomeip_v3 {
+
+external_payload_impl::external_payload_impl(const byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner) :
+    external_data_(_data), writable_data_(nullptr), external_length_(_size), owner_(std::move(_owner)), is_external_(true) { }
+
+external_payload_impl::external_payload_impl(byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner, bool _is_writable) :
+    external_data_(_data), writable_data_(_is_writable ? _data : nullptr), external_length_(_size), owner_(std::move(_owner)),
+    is_external_(true) { }
+
+bool external_payload_impl::operator==(const payload& _other) {
+    bool is_equal{get_length() == _other.get_length()};
+    if (is_equal && get_length() > 0) {
+        const external_payload_impl& its_this{*this};
+        is_equal = (0 == std::memcmp(its_this.get_data(), _other.get_data(), get_length()));
+    }
+    return is_equal;
+}
+
+byte_t* external_payload_impl::get_data() {
+    if (is_external_ && writable_data_) {
+        return writable_data_;
+    }
+    detach();
+    return data_.data();
+}
+
+const byte_t* external_payload_impl::get_data() const {
+    return is_external_ ? external_data_ : data_.data();
+}
+
+length_t external_payload_impl::get_length() const {
+    return is_external_ ? external_length_ : length_t(data_.size());
+}
+
+void external_payload_impl::set_capacity(length_t _capacity) {
+    detach();
+    data_.reserve(_capacity);
+}
+
+void external_payload_impl::set_data(const byte_t* _data, const length_t _length) {
+    data_.assign(_data, _data + _length);
+    is_external_ = false;
+    owner_.reset();
+}
+
+void external_payload_impl::set_data(const std::vector<byte_t>& _data) {
+    data_ = _data;
+    is_external_ = false;
+    owner_.reset();
+}
+
+void external_payload_impl::set_data(std::vector<byte_t>&& _data) {
+    data_ = std::move(_data);
+    is_external_ = false;
+    owner_.reset();
+}
+
+bool external_payload_impl::serialize(serializer* _to) const {
+    if (0 == _to) {
+        return false;
+    }
+    if (is_external_) {
+        return (external_length_ == 0 || _to->serialize(external_data_, external_length_));
+    }
+    return _to->serialize(data_);
+}
+
+bool external_payload_impl::deserialize(deserializer* _from) {
+    if (0 == _from) {
+        return false;
+    }
+    is_external_ = false;
+    owner_.reset();
+    return _from->deserialize(data_);
+}
+
+bool external_payload_impl::is_external() const {
+    return is_external_;
+}
+
+void external_payload_impl::detach() {
+    if (is_external_) {
+        data_.assign(external_data_, external_data_ + external_length_);
+        is_external_ = false;
+        writable_data_ = nullptr;
+        owner_.reset();
+    }
+}
+
+} // namespace vsomeip_v3
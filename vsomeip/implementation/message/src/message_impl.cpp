@@ -7,7 +7,10 @@
 #include <vsomeip/payload.hpp>
 #include <vsomeip/runtime.hpp>
 
+#include "../include/external_payload_impl.hpp"
 #include "../include/message_impl.hpp"
+#include "../include/message_pool.hpp"
+#include "../include/payload_impl.hpp"
 #ifdef ANDROID
 #include "../../configuration/include/internal_android.hpp"
 #else
@@ -38,11 +41,23 @@ bool message_impl::serialize(serializer* _to) const {
 }
 
 bool message_impl::deserialize(deserializer* _from) {
-    payload_ = runtime::get()->create_payload();
+    auto its_payload = message_pool::create_payload();
+    payload_ = its_payload;
     bool is_successful = header_.deserialize(_from);
     if (is_successful) {
-        payload_->set_capacity(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
-        is_successful = payload_->deserialize(_from);
+        its_payload->set_capacity(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
+        is_successful = its_payload->deserialize(_from);
+    }
+    return is_successful;
+}
+
+bool message_impl::deserialize(deserializer* _from, byte_t* _data, length_t _length, std::shared_ptr<void> _owner) {
+    bool is_successful = header_.deserialize(_from);
+    if (is_successful) {
+        is_successful = (header_.length_ >= VSOMEIP_SOMEIP_HEADER_SIZE && header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE <= _length);
+        if (is_successful) {
+            payload_ = message_pool::create_payload_view(_data, header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE, std::move(_owner));
+        }
     }
     return is_successful;
 }
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/external_payload_impl.hpp"
+#include "../include/message_impl.hpp"
+#include "../include/message_pool.hpp"
+#include "../include/payload_impl.hpp"
+#ifdef ANDROID
+#include "../../configuration/include/internal_android.hpp"
+#else
+#include "../../configuration/include/internal.hpp"
+#endif
+
+namespace vsomeip_v3 {
+
+namespace {
+free_list<std::vector<byte_t>>& buffers() {
+    // Never destroyed, buffers may be returned by static destructors
+    static auto* its_buffers = new free_list<std::vector<byte_t>>;
+    return *its_buffers;
+}
+}
+
+std::atomic<std::size_t> message_pool::capacity_{VSOMEIP_DEFAULT_MESSAGE_POOL_CAPACITY};
+
+void message_pool::set_capacity(std::size_t _capacity) {
+    capacity_ = _capacity;
+}
+
+std::size_t message_pool::get_capacity() {
+    return capacity_.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<message_impl> message_pool::create_message() {
+    return std::allocate_shared<message_impl>(detail::pool_allocator<message_impl>{});
+}
+
+std::shared_ptr<payload_impl> message_pool::create_payload() {
+    return std::allocate_shared<payload_impl>(detail::pool_allocator<payload_impl>{});
+}
+
+std::shared_ptr<external_payload_impl> message_pool::create_payload_view(byte_t* _data, length_t _length, std::shared_ptr<void> _owner) {
+    return std::allocate_shared<external_payload_impl>(detail::pool_allocator<external_payload_impl>{}, _data, _length, std::move(_owner),
+                                                       true);
+}
+
+std::vector<byte_t> message_pool::acquire_buffer() {
+    if (get_capacity() == 0) {
+        return {};
+    }
+    return buffers().acquire();
+}
+
+void message_pool::release_buffer(std::vector<byte_t>&& _buffer) {
+    // Large buffers are rare, keeping them would only hold memory
+    if (_buffer.capacity() == 0 || _buffer.capacity() > VSOMEIP_MESSAGE_POOL_MAX_BUFFER_SIZE) {
+        return;
+    }
+    _buffer.clear();
+    buffers().release(std::move(_buffer), get_capacity());
+}
+
+} // namespace vsomeip_v3
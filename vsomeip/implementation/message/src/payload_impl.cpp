@@ -6,20 +6,32 @@
 #include <cstring>
 
 #include "../include/deserializer.hpp"
+#include "../include/message_pool.hpp"
 #include "../include/payload_impl.hpp"
 #include "../include/serializer.hpp"
 
 namespace vsomeip_v3 {
 
-payload_impl::payload_impl() : data_() { }
+payload_impl::payload_impl() : data_(message_pool::acquire_buffer()), capacity_{0}, has_capacity_{false} { }
 
-payload_impl::payload_impl(const byte_t* _data, uint32_t _size) {
+payload_impl::payload_impl(const byte_t* _data, uint32_t _size) :
+    data_(message_pool::acquire_buffer()), capacity_{0}, has_capacity_{false} {
     data_.assign(_data, _data + _size);
 }
 
-payload_impl::payload_impl(const std::vector<byte_t>& _data) : data_(_data) { }
+payload_impl::payload_impl(const std::vector<byte_t>& _data) :
+    data_(message_pool::acquire_buffer()), capacity_{0}, has_capacity_{false} {
+    data_.assign(_data.begin(), _data.end());
+}
+
+payload_impl::payload_impl(const payload_impl& _payload) :
+    data_(message_pool::acquire_buffer()), capacity_{_payload.capacity_}, has_capacity_{_payload.has_capacity_} {
+    data_.assign(_payload.data_.begin(), _payload.data_.end());
+}
 
-payload_impl::payload_impl(const payload_impl& _payload) : data_(_payload.data_) { }
+payload_impl::~payload_impl() {
+    message_pool::release_buffer(std::move(data_));
+}
 
 bool payload_impl::operator==(const payload& _other) {
     bool is_equal{get_length() == _other.get_length()};
@@ -43,6 +55,8 @@ length_t payload_impl::get_length() const {
 
 void payload_impl::set_capacity(length_t _capacity) {
     data_.reserve(_capacity);
+    capacity_ = _capacity;
+    has_capacity_ = true;
 }
 
 void payload_impl::set_data(const byte_t* _data, const length_t _length) {
@@ -54,6 +68,7 @@ void payload_impl::set_data(const std::vector<byte_t>& _data) {
 }
 
 void payload_impl::set_data(std::vector<byte_t>&& _data) {
+    message_pool::release_buffer(std::move(data_));
     data_ = std::move(_data);
 }
 
@@ -62,7 +77,15 @@ bool payload_impl::serialize(serializer* _to) const {
 }
 
 bool payload_impl::deserialize(deserializer* _from) {
-    return (0 != _from && _from->deserialize(data_));
+    if (0 == _from) {
+        return false;
+    }
+
+    // The length applies to this deserialization only
+    const std::size_t its_length{has_capacity_ ? capacity_ : data_.capacity()};
+    capacity_ = 0;
+    has_capacity_ = false;
+    return _from->deserialize(data_, its_length);
 }
 
 } // namespace vsomeip_v3
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+
+#include "../include/receive_buffer_lender.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+thread_local receive_buffer_lender::scope* current_scope{nullptr};
+} // namespace
+
+receive_buffer_lender::scope::scope(receive_buffer_lender& _lender, std::vector<byte_t>& _buffer) :
+    lender_(_lender), buffer_(_buffer), remainder_(nullptr), previous_(current_scope) {
+    current_scope = this;
+}
+
+receive_buffer_lender::scope::scope(receive_buffer_lender& _lender, std::vector<byte_t>& _buffer, const std::size_t& _remainder) :
+    lender_(_lender), buffer_(_buffer), remainder_(&_remainder), previous_(current_scope) {
+    current_scope = this;
+}
+
+receive_buffer_lender::scope::~scope() {
+    current_scope = previous_;
+    reclaim(0, remainder_ ? *remainder_ : 0);
+}
+
+bool receive_buffer_lender::scope::reclaim(std::size_t _offset, std::size_t _length) {
+    auto& its_lent = lender_.lent_;
+    if (!its_lent || its_lent.use_count() == 1) {
+        // Nothing references the buffer, the owner is kept for the next one
+        return false;
+    }
+
+    std::vector<byte_t> its_spare = lender_.take_spare();
+    its_spare.resize(buffer_.size());
+    _length = std::min(_length, buffer_.size() - std::min(_offset, buffer_.size()));
+    std::copy_n(buffer_.begin() + static_cast<std::ptrdiff_t>(_offset), _length, its_spare.begin());
+
+    // Swapping keeps the memory in place, the payloads stay valid
+    its_lent->swap(buffer_);
+    buffer_.swap(its_spare);
+    its_lent.reset();
+    return true;
+}
+
+receive_buffer_lender::receive_buffer_lender() : spares_(std::make_shared<spares>()) { }
+
+std::shared_ptr<void> receive_buffer_lender::lend(const byte_t* _data, std::size_t _length, byte_t*& _view) {
+    for (scope* its_scope = current_scope; its_scope != nullptr; its_scope = its_scope->previous_) {
+        auto& its_buffer = its_scope->buffer_;
+        const byte_t* its_begin = its_buffer.data();
+        if (_data >= its_begin && _data <= its_begin + its_buffer.size()
+            && _length <= static_cast<std::size_t>(its_begin + its_buffer.size() - _data)) {
+            if (_length < its_buffer.size() / max_view_ratio_) {
+                return nullptr;
+            }
+            auto& its_lender = its_scope->lender_;
+            if (!its_lender.lent_) {
+                if (its_lender.spares_->lent_count_ >= max_lent_) {
+                    return nullptr;
+                }
+                its_lender.spares_->lent_count_++;
+                its_lender.lent_ = std::shared_ptr<std::vector<byte_t>>(new std::vector<byte_t>, give_back{its_lender.spares_});
+            }
+            _view = its_buffer.data() + (_data - its_begin);
+            return its_lender.lent_;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<byte_t> receive_buffer_lender::take_spare() {
+    std::vector<byte_t> its_spare;
+    std::scoped_lock its_lock{spares_->mutex_};
+    if (!spares_->buffers_.empty()) {
+        its_spare = std::move(spares_->buffers_.back());
+        spares_->buffers_.pop_back();
+    }
+    return its_spare;
+}
+
+void receive_buffer_lender::give_back::operator()(std::vector<byte_t>* _buffer) const {
+    auto its_spares = spares_.lock();
+    if (its_spares) {
+        its_spares->lent_count_--;
+        if (_buffer->capacity() > 0) {
+            std::scoped_lock its_lock{its_spares->mutex_};
+            if (its_spares->buffers_.size() < max_spares_) {
+                its_spares->buffers_.push_back(std::move(*_buffer));
+            }
+        }
+    }
+    delete _buffer;
+}
+
+} // namespace vsomeip_v3
@@ -28,7 +28,15 @@ public:
     bool add_registration(const register_event& _register_event);
     bool get_registration_at(std::size_t _position, register_event& _reg) const;
 
+    // Distributes _registrations in order over as few commands of at most _max_size bytes as
+    // possible. Returns false if a registration does not fit into a command on its own, _commands
+    // then holds the commands for the registrations before it.
+    static bool split(client_t _client, const std::vector<register_event>& _registrations, std::size_t _max_size,
+                      std::vector<register_events_command>& _commands);
+
 private:
+    bool add_registration(const register_event& _register_event, std::size_t _max_size);
+
     std::vector<register_event> registrations_;
 };
 
@@ -16,6 +16,9 @@ public:
     send_command(id_e _id);
 
     void serialize(std::vector<byte_t>& _buffer, error_e& _error) const;
+    // Serializes the command up to its message, which has _message_size bytes
+    // and is sent behind _buffer without being copied into it.
+    void serialize_header(std::vector<byte_t>& _buffer, std::size_t _message_size, error_e& _error) const;
     void deserialize(const std::vector<byte_t>& _buffer, error_e& _error);
 
     instance_t get_instance() const;
@@ -32,6 +35,7 @@ public:
 
     // TODO: Optimize this as the vector might be huge!
     std::vector<byte_t> get_message() const;
+    std::size_t get_message_size() const;
     void set_message(const std::vector<byte_t>& _message);
 
 private:
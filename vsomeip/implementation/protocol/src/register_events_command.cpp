@@ -15,13 +15,18 @@ register_events_command::register_events_command() : command(id_e::REGISTER_EVEN
 
 bool register_events_command::add_registration(const register_event& _register_event) {
 
+    return add_registration(_register_event, std::numeric_limits<command_size_t>::max());
+}
+
+bool register_events_command::add_registration(const register_event& _register_event, std::size_t _max_size) {
+
     size_t its_size(size_ + COMMAND_HEADER_SIZE + sizeof(_register_event.get_service()) + sizeof(_register_event.get_instance())
                     + sizeof(_register_event.get_event()) + sizeof(_register_event.get_event_type()) + sizeof(_register_event.is_provided())
                     + sizeof(_register_event.get_reliability()) + sizeof(_register_event.is_cyclic())
                     + sizeof(_register_event.get_num_eventgroups()) + (_register_event.get_num_eventgroups() * sizeof(eventgroup_t)));
 
     // check size
-    if (its_size > std::numeric_limits<command_size_t>::max())
+    if (its_size > _max_size || its_size > std::numeric_limits<command_size_t>::max())
         return false;
 
     // set size
@@ -94,5 +99,25 @@ bool register_events_command::get_registration_at(std::size_t _position, registe
     return false;
 }
 
+bool register_events_command::split(client_t _client, const std::vector<register_event>& _registrations, std::size_t _max_size,
+                                    std::vector<register_events_command>& _commands) {
+
+    auto its_registration = _registrations.begin();
+    while (its_registration != _registrations.end()) {
+        register_events_command its_command;
+        its_command.set_client(_client);
+        for (; its_registration != _registrations.end(); its_registration++) {
+            if (!its_command.add_registration(*its_registration, _max_size)) {
+                break;
+            }
+        }
+        if (its_command.get_num_registrations() == 0) {
+            return false;
+        }
+        _commands.push_back(std::move(its_command));
+    }
+    return true;
+}
+
 } // namespace protocol
 } // namespace vsomeip_v3
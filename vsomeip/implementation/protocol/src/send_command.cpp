@@ -57,6 +57,11 @@ std::vector<byte_t> send_command::get_message() const {
     return message_;
 }
 
+std::size_t send_command::get_message_size() const {
+
+    return message_.size();
+}
+
 void send_command::set_message(const std::vector<byte_t>& _message) {
 
     message_ = std::move(_message);
@@ -64,7 +69,18 @@ void send_command::set_message(const std::vector<byte_t>& _message) {
 
 void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const {
 
-    size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_) + message_.size());
+    serialize_header(_buffer, message_.size(), _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    // serialize message
+    _buffer.insert(_buffer.end(), message_.begin(), message_.end());
+}
+
+void send_command::serialize_header(std::vector<byte_t>& _buffer, std::size_t _message_size, error_e& _error) const {
+
+    size_t its_header_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_));
+    size_t its_size(its_header_size + _message_size);
 
     if (its_size > std::numeric_limits<command_size_t>::max()) {
 
@@ -72,8 +88,8 @@ void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) cons
         return;
     }
 
-    // resize buffer
-    _buffer.resize(its_size);
+    // resize buffer, the message is not part of it
+    _buffer.resize(its_header_size);
 
     // set size
     size_ = static_cast<command_size_t>(its_size - COMMAND_HEADER_SIZE);
@@ -92,8 +108,6 @@ void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) cons
     _buffer[its_offset] = static_cast<byte_t>(status_);
     its_offset += sizeof(status_);
     std::memcpy(&_buffer[its_offset], &target_, sizeof(target_));
-    its_offset += sizeof(target_);
-    std::memcpy(&_buffer[its_offset], &message_[0], message_.size());
 }
 
 void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error) {
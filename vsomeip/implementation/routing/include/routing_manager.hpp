@@ -85,6 +85,9 @@ public:
                                 epsilon_change_func_t _epsilon_change_func, bool _is_provided, bool _is_shadow = false,
                                 bool _is_cache_placeholder = false) = 0;
 
+    virtual void register_events(client_t _client, service_t _service, instance_t _instance,
+                                 const std::vector<event_registration_t>& _events, bool _is_provided) = 0;
+
     virtual void unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _event, bool _is_provided) = 0;
 
     virtual std::shared_ptr<event> find_event(service_t _service, instance_t _instance, event_t _event) const = 0;
@@ -90,6 +90,9 @@ public:
                                 epsilon_change_func_t _epsilon_change_func, bool _is_provided, bool _is_shadow = false,
                                 bool _is_cache_placeholder = false);
 
+    virtual void register_events(client_t _client, service_t _service, instance_t _instance,
+                                 const std::vector<event_registration_t>& _events, bool _is_provided);
+
     virtual void unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _event, bool _is_provided);
 
     virtual std::set<std::shared_ptr<event>> find_events(service_t _service, instance_t _instance, eventgroup_t _eventgroup) const;
@@ -171,9 +174,21 @@ protected:
 
     bool send_local_notification(client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance, bool _reliable,
                                  uint8_t _status_check, bool _force);
+    // The message consists of the _header_size bytes at _header, that hold at least its
+    // SOME/IP header unless the message is shorter, followed by the _size bytes at _data
+    bool send_local_notification(client_t _client, const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size,
+                                 instance_t _instance, bool _reliable, uint8_t _status_check, bool _force);
 
     bool send_local(std::shared_ptr<endpoint>& _target, client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance,
                     bool _reliable, protocol::id_e _command, uint8_t _status_check) const;
+    // Sends the message consisting of the _header_size bytes at _header followed by the
+    // _size bytes at _data. The parts are joined by the endpoint when queuing the message.
+    bool send_local(std::shared_ptr<endpoint>& _target, client_t _client, const byte_t* _header, uint32_t _header_size, const byte_t* _data,
+                    uint32_t _size, instance_t _instance, bool _reliable, protocol::id_e _command, uint8_t _status_check) const;
+
+#ifdef USE_DLT
+    void trace_message(instance_t _instance, const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size) const;
+#endif
 
     bool insert_subscription(service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event,
                              const std::shared_ptr<debounce_filter_impl_t>& _filter, client_t _client,
@@ -31,6 +31,7 @@ class routing_manager_host;
 
 namespace protocol {
 class offered_services_response_command;
+class register_event;
 class update_security_credentials_command;
 }
 
@@ -69,6 +70,8 @@ public:
     void unsubscribe(client_t _client, const vsomeip_sec_client_t* _sec_client, service_t _service, instance_t _instance,
                      eventgroup_t _eventgroup, event_t _event);
 
+    bool send(client_t _client, std::shared_ptr<message> _message, bool _force);
+
     bool send(client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance, bool _reliable, client_t _bound_client,
               const vsomeip_sec_client_t* _sec_client, uint8_t _status_check, bool _sent_from_remote, bool _force);
 
@@ -81,6 +84,9 @@ public:
                         std::chrono::milliseconds _cycle, bool _change_resets_cycle, bool _update_on_change,
                         epsilon_change_func_t _epsilon_change_func, bool _is_provided, bool _is_shadow, bool _is_cache_placeholder);
 
+    void register_events(client_t _client, service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events,
+                         bool _is_provided);
+
     void unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _notifier, bool _is_provided);
 
     void on_connect(const std::shared_ptr<endpoint>& _endpoint);
@@ -98,6 +104,11 @@ public:
     void send_get_offered_services_info(client_t _client, offer_type_e _offer_type);
 
 private:
+    // Sends the message consisting of the _header_size bytes at _header, that hold at least
+    // its SOME/IP header unless the message is shorter, followed by the _size bytes at _data
+    bool send(client_t _client, const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size, instance_t _instance,
+              bool _reliable, uint8_t _status_check, bool _force);
+
     void assign_client();
     void register_application();
     void deregister_application();
@@ -112,9 +123,15 @@ private:
 
     [[nodiscard]] bool send_pending_event_registrations(client_t _client);
 
+    bool add_event_registration(client_t _client, service_t _service, instance_t _instance, event_t _notifier,
+                                const std::set<eventgroup_t>& _eventgroups, const event_type_e _type, reliability_type_e _reliability,
+                                std::chrono::milliseconds _cycle, bool _change_resets_cycle, bool _update_on_change,
+                                epsilon_change_func_t _epsilon_change_func, bool _is_provided);
+
     void send_register_event(client_t _client, service_t _service, instance_t _instance, event_t _notifier,
                              const std::set<eventgroup_t>& _eventgroups, const event_type_e _type, reliability_type_e _reliability,
                              bool _is_provided, bool _is_cyclic);
+    void send_register_events(const std::vector<protocol::register_event>& _registrations);
 
     void send_subscribe(client_t _client, service_t _service, instance_t _instance, eventgroup_t _eventgroup, major_version_t _major,
                         event_t _event, const std::shared_ptr<debounce_filter_impl_t>& _filter);
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <iomanip>
 
 #include <vsomeip/runtime.hpp>
@@ -545,6 +546,14 @@ void routing_manager_base::register_event(client_t _client, service_t _service,
     events_[service_instance_t{_service, _instance}][_notifier] = its_event;
 }
 
+void routing_manager_base::register_events(client_t _client, service_t _service, instance_t _instance,
+                                           const std::vector<event_registration_t>& _events, bool _is_provided) {
+    for (const auto& its_event : _events) {
+        register_event(_client, _service, _instance, its_event.event_, its_event.eventgroups_, its_event.type_, its_event.reliability_,
+                       its_event.cycle_, its_event.change_resets_cycle_, its_event.update_on_change_, nullptr, _is_provided);
+    }
+}
+
 void routing_manager_base::unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _event, bool _is_provided) {
     (void)_client;
     std::shared_ptr<event> its_unrefed_event;
@@ -1210,13 +1219,21 @@ void routing_manager_base::remove_eventgroup_info(service_t _service, instance_t
 
 bool routing_manager_base::send_local_notification(client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance,
                                                    bool _reliable, uint8_t _status_check, bool _force) {
+    const uint32_t its_header_size{std::min(_size, uint32_t(VSOMEIP_FULL_HEADER_SIZE))};
+    return send_local_notification(_client, _data, its_header_size, _data + its_header_size, _size - its_header_size, _instance, _reliable,
+                                   _status_check, _force);
+}
+
+bool routing_manager_base::send_local_notification(client_t _client, const byte_t* _header, uint32_t _header_size, const byte_t* _data,
+                                                   uint32_t _size, instance_t _instance, bool _reliable, uint8_t _status_check,
+                                                   bool _force) {
 #ifdef USE_DLT
     bool has_local(false);
 #endif
     (void)_client;
     bool has_remote(false);
-    service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
-    method_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
+    service_t its_service = bithelper::read_uint16_be(&_header[VSOMEIP_SERVICE_POS_MIN]);
+    method_t its_method = bithelper::read_uint16_be(&_header[VSOMEIP_METHOD_POS_MIN]);
 
     std::shared_ptr<event> its_event = find_event(its_service, _instance, its_method);
     if (its_event && !its_event->is_shadow()) {
@@ -1235,16 +1252,15 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
 
             std::shared_ptr<endpoint> its_local_target = ep_mgr_->find_local(its_client);
             if (its_local_target) {
-                send_local(its_local_target, its_client, _data, _size, _instance, _reliable, protocol::id_e::SEND_ID, _status_check);
+                send_local(its_local_target, its_client, _header, _header_size, _data, _size, _instance, _reliable, protocol::id_e::SEND_ID,
+                           _status_check);
             }
         }
     }
 #ifdef USE_DLT
     // Trace the message if a local client but will _not_ be forwarded to the routing manager
     if (has_local && !has_remote) {
-        trace::header its_header;
-        if (its_header.prepare(nullptr, true, _instance))
-            tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+        trace_message(_instance, _header, _header_size, _data, _size);
     }
 #endif
     return has_remote;
@@ -1253,6 +1269,13 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
 bool routing_manager_base::send_local(std::shared_ptr<endpoint>& _target, client_t _client, const byte_t* _data, uint32_t _size,
                                       instance_t _instance, bool _reliable, protocol::id_e _command, uint8_t _status_check) const {
 
+    return send_local(_target, _client, nullptr, 0, _data, _size, _instance, _reliable, _command, _status_check);
+}
+
+bool routing_manager_base::send_local(std::shared_ptr<endpoint>& _target, client_t _client, const byte_t* _header, uint32_t _header_size,
+                                      const byte_t* _data, uint32_t _size, instance_t _instance, bool _reliable, protocol::id_e _command,
+                                      uint8_t _status_check) const {
+
     bool has_sent(false);
 
     protocol::send_command its_command(_command);
@@ -1261,18 +1284,39 @@ bool routing_manager_base::send_local(std::shared_ptr<endpoint>& _target, client
     its_command.set_reliable(_reliable);
     its_command.set_status(_status_check);
     its_command.set_target(_client);
-    its_command.set_message(std::vector<byte_t>(_data, _data + _size));
 
+    // Only the command header and the SOME/IP header are serialized here,
+    // the payload is copied once, into the send queue of the endpoint
     std::vector<byte_t> its_buffer;
     protocol::error_e its_error;
-    its_command.serialize(its_buffer, its_error);
+    its_command.serialize_header(its_buffer, std::size_t(_header_size) + _size, its_error);
     if (its_error == protocol::error_e::ERROR_OK) {
-        has_sent = _target->send(&its_buffer[0], uint32_t(its_buffer.size()));
+        its_buffer.insert(its_buffer.end(), _header, _header + _header_size);
+        has_sent = _target->send(its_buffer, _data, _size);
     }
 
     return has_sent;
 }
 
+#ifdef USE_DLT
+void routing_manager_base::trace_message(instance_t _instance, const byte_t* _header, uint32_t _header_size, const byte_t* _data,
+                                         uint32_t _size) const {
+
+    trace::header its_trace_header;
+    if (its_trace_header.prepare(nullptr, true, _instance)) {
+        if (_size == 0) {
+            tc_->trace(its_trace_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _header, _header_size);
+        } else if (_header_size == 0) {
+            tc_->trace(its_trace_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+        } else {
+            std::vector<byte_t> its_message(_header, _header + _header_size);
+            its_message.insert(its_message.end(), _data, _data + _size);
+            tc_->trace(its_trace_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), uint32_t(its_message.size()));
+        }
+    }
+}
+#endif
+
 bool routing_manager_base::insert_subscription(service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event,
                                                const std::shared_ptr<debounce_filter_impl_t>& _filter, client_t _client,
                                                std::set<event_t>* _already_subscribed_events) {
@@ -11,6 +11,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <climits>
 #include <forward_list>
 #include <future>
@@ -22,6 +23,7 @@
 #include <boost/asio/post.hpp>
 
 #include <vsomeip/constants.hpp>
+#include <vsomeip/payload.hpp>
 #include <vsomeip/runtime.hpp>
 #include <vsomeip/internal/logger.hpp>
 
@@ -477,6 +479,44 @@ void routing_manager_client::register_event(client_t _client, service_t _service
     (void)_is_shadow;
     (void)_is_cache_placeholder;
 
+    bool is_first = add_event_registration(_client, _service, _instance, _notifier, _eventgroups, _type, _reliability, _cycle,
+                                           _change_resets_cycle, _update_on_change, _epsilon_change_func, _is_provided);
+    {
+        std::scoped_lock its_registration_lock{registration_state_mutex_};
+        if (state_ == inner_state_type_e::ST_REGISTERED && is_first) {
+            send_register_event(get_client(), _service, _instance, _notifier, _eventgroups, _type, _reliability, _is_provided,
+                                _cycle != std::chrono::milliseconds::zero());
+        }
+    }
+}
+
+void routing_manager_client::register_events(client_t _client, service_t _service, instance_t _instance,
+                                             const std::vector<event_registration_t>& _events, bool _is_provided) {
+
+    std::vector<protocol::register_event> its_registrations;
+    for (const auto& its_event : _events) {
+        if (add_event_registration(_client, _service, _instance, its_event.event_, its_event.eventgroups_, its_event.type_,
+                                   its_event.reliability_, its_event.cycle_, its_event.change_resets_cycle_, its_event.update_on_change_,
+                                   nullptr, _is_provided)) {
+            its_registrations.emplace_back(_service, _instance, its_event.event_, its_event.type_, _is_provided, its_event.reliability_,
+                                           its_event.cycle_ != std::chrono::milliseconds::zero(),
+                                           static_cast<uint16_t>(its_event.eventgroups_.size()), its_event.eventgroups_);
+        }
+    }
+
+    // Registrations made before the application is registered are sent with the pending ones
+    std::scoped_lock its_registration_lock{registration_state_mutex_};
+    if (state_ == inner_state_type_e::ST_REGISTERED && !its_registrations.empty()) {
+        send_register_events(its_registrations);
+    }
+}
+
+bool routing_manager_client::add_event_registration(client_t _client, service_t _service, instance_t _instance, event_t _notifier,
+                                                    const std::set<eventgroup_t>& _eventgroups, const event_type_e _type,
+                                                    reliability_type_e _reliability, std::chrono::milliseconds _cycle,
+                                                    bool _change_resets_cycle, bool _update_on_change,
+                                                    epsilon_change_func_t _epsilon_change_func, bool _is_provided) {
+
     bool is_cyclic(_cycle != std::chrono::milliseconds::zero());
 
     const event_data_t registration = {_service, _instance, _notifier, _type, _reliability, _is_provided, is_cyclic, _eventgroups};
@@ -514,12 +554,7 @@ void routing_manager_client::register_event(client_t _client, service_t _service
         routing_manager_base::register_event(_client, _service, _instance, _notifier, _eventgroups, _type, _reliability, _cycle,
                                              _change_resets_cycle, _update_on_change, _epsilon_change_func, _is_provided);
     }
-    {
-        std::scoped_lock its_registration_lock{registration_state_mutex_};
-        if (state_ == inner_state_type_e::ST_REGISTERED && is_first) {
-            send_register_event(get_client(), _service, _instance, _notifier, _eventgroups, _type, _reliability, _is_provided, is_cyclic);
-        }
-    }
+    return is_first;
 }
 
 void routing_manager_client::unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _notifier,
@@ -754,6 +789,31 @@ void routing_manager_client::unsubscribe(client_t _client, const vsomeip_sec_cli
     }
 }
 
+bool routing_manager_client::send(client_t _client, std::shared_ptr<message> _message, bool _force) {
+    if (utility::is_request(_message->get_message_type())) {
+        _message->set_client(_client);
+    }
+
+    // Only the header is serialized, the payload is handed to the endpoint as it is
+    byte_t its_header[VSOMEIP_FULL_HEADER_SIZE];
+    bithelper::write_uint16_be(_message->get_service(), &its_header[VSOMEIP_SERVICE_POS_MIN]);
+    bithelper::write_uint16_be(_message->get_method(), &its_header[VSOMEIP_METHOD_POS_MIN]);
+    bithelper::write_uint32_be(_message->get_length(), &its_header[VSOMEIP_LENGTH_POS_MIN]);
+    bithelper::write_uint16_be(_message->get_client(), &its_header[VSOMEIP_CLIENT_POS_MIN]);
+    bithelper::write_uint16_be(_message->get_session(), &its_header[VSOMEIP_SESSION_POS_MIN]);
+    its_header[VSOMEIP_PROTOCOL_VERSION_POS] = _message->get_protocol_version();
+    its_header[VSOMEIP_INTERFACE_VERSION_POS] = _message->get_interface_version();
+    its_header[VSOMEIP_MESSAGE_TYPE_POS] = static_cast<byte_t>(_message->get_message_type());
+    its_header[VSOMEIP_RETURN_CODE_POS] = static_cast<byte_t>(_message->get_return_code());
+
+    std::shared_ptr<const payload> its_payload{_message->get_payload()};
+    const byte_t* its_data = its_payload ? its_payload->get_data() : nullptr;
+    const uint32_t its_size = its_payload ? its_payload->get_length() : 0;
+
+    return send(_client, its_header, VSOMEIP_FULL_HEADER_SIZE, its_data, its_size, _message->get_instance(), _message->is_reliable(), 0,
+                _force);
+}
+
 bool routing_manager_client::send(client_t _client, const byte_t* _data, length_t _size, instance_t _instance, bool _reliable,
                                   client_t _bound_client, const vsomeip_sec_client_t* _sec_client, uint8_t _status_check,
                                   bool _sent_from_remote, bool _force) {
@@ -761,6 +821,14 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
     (void)_bound_client;
     (void)_sec_client;
     (void)_sent_from_remote;
+    const uint32_t its_header_size{std::min(_size, length_t(VSOMEIP_FULL_HEADER_SIZE))};
+    return send(_client, _data, its_header_size, _data + its_header_size, _size - its_header_size, _instance, _reliable, _status_check,
+                _force);
+}
+
+bool routing_manager_client::send(client_t _client, const byte_t* _header, uint32_t _header_size, const byte_t* _data, uint32_t _size,
+                                  instance_t _instance, bool _reliable, uint8_t _status_check, bool _force) {
+
     bool is_sent{false};
     bool has_remote_subscribers{false};
     {
@@ -769,56 +837,56 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         }
     }
     if (client_side_logging_) {
-        if (_size > VSOMEIP_MESSAGE_TYPE_POS) {
-            service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+        if (_header_size > VSOMEIP_MESSAGE_TYPE_POS) {
+            service_t its_service = bithelper::read_uint16_be(&_header[VSOMEIP_SERVICE_POS_MIN]);
             if (client_side_logging_filter_.empty() || (1 == client_side_logging_filter_.count(std::make_tuple(its_service, ANY_INSTANCE)))
                 || (1 == client_side_logging_filter_.count(std::make_tuple(its_service, _instance)))) {
-                method_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
-                session_t its_session = bithelper::read_uint16_be(&_data[VSOMEIP_SESSION_POS_MIN]);
-                client_t its_client = bithelper::read_uint16_be(&_data[VSOMEIP_CLIENT_POS_MIN]);
+                method_t its_method = bithelper::read_uint16_be(&_header[VSOMEIP_METHOD_POS_MIN]);
+                session_t its_session = bithelper::read_uint16_be(&_header[VSOMEIP_SESSION_POS_MIN]);
+                client_t its_client = bithelper::read_uint16_be(&_header[VSOMEIP_CLIENT_POS_MIN]);
                 VSOMEIP_INFO << "routing_manager_client::send: (" << std::hex << std::setfill('0') << std::setw(4) << get_client() << "): ["
                              << std::setw(4) << its_service << "." << std::setw(4) << _instance << "." << std::setw(4) << its_method << ":"
                              << std::setw(4) << its_session << ":" << std::setw(4) << its_client << "] "
-                             << "type=" << std::hex << static_cast<std::uint32_t>(_data[VSOMEIP_MESSAGE_TYPE_POS]) << " thread=" << std::hex
-                             << std::this_thread::get_id();
+                             << "type=" << std::hex << static_cast<std::uint32_t>(_header[VSOMEIP_MESSAGE_TYPE_POS])
+                             << " thread=" << std::hex << std::this_thread::get_id();
             }
         } else {
             VSOMEIP_ERROR << "routing_manager_client::send: (" << std::hex << std::setfill('0') << std::setw(4) << get_client()
-                          << "): message too short to log: " << std::dec << _size;
+                          << "): message too short to log: " << std::dec << _header_size + _size;
         }
     }
-    if (_size > VSOMEIP_MESSAGE_TYPE_POS) {
+    if (_header_size > VSOMEIP_MESSAGE_TYPE_POS) {
         std::shared_ptr<endpoint> its_target;
-        if (utility::is_request(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
+        if (utility::is_request(_header[VSOMEIP_MESSAGE_TYPE_POS])) {
             // Request
-            service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+            service_t its_service = bithelper::read_uint16_be(&_header[VSOMEIP_SERVICE_POS_MIN]);
             client_t its_client = find_local_client(its_service, _instance);
             if (its_client != VSOMEIP_ROUTING_CLIENT) {
                 if (is_client_known(its_client)) {
                     its_target = ep_mgr_->find_or_create_local(its_client);
                 }
             }
-        } else if (!utility::is_notification(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
+        } else if (!utility::is_notification(_header[VSOMEIP_MESSAGE_TYPE_POS])) {
             // Response
-            client_t its_client = bithelper::read_uint16_be(&_data[VSOMEIP_CLIENT_POS_MIN]);
+            client_t its_client = bithelper::read_uint16_be(&_header[VSOMEIP_CLIENT_POS_MIN]);
             if (its_client != VSOMEIP_ROUTING_CLIENT) {
                 if (is_client_known(its_client)) {
                     its_target = ep_mgr_->find_or_create_local(its_client);
                 }
             }
-        } else if (utility::is_notification(_data[VSOMEIP_MESSAGE_TYPE_POS]) && _client == VSOMEIP_ROUTING_CLIENT) {
+        } else if (utility::is_notification(_header[VSOMEIP_MESSAGE_TYPE_POS]) && _client == VSOMEIP_ROUTING_CLIENT) {
             // notify
-            has_remote_subscribers = send_local_notification(get_client(), _data, _size, _instance, _reliable, _status_check, _force);
-        } else if (utility::is_notification(_data[VSOMEIP_MESSAGE_TYPE_POS]) && _client != VSOMEIP_ROUTING_CLIENT) {
+            has_remote_subscribers = send_local_notification(get_client(), _header, _header_size, _data, _size, _instance, _reliable,
+                                                             _status_check, _force);
+        } else if (utility::is_notification(_header[VSOMEIP_MESSAGE_TYPE_POS]) && _client != VSOMEIP_ROUTING_CLIENT) {
             // notify_one
             its_target = ep_mgr_->find_local(_client);
             if (its_target) {
-                is_sent = send_local(its_target, get_client(), _data, _size, _instance, _reliable, protocol::id_e::SEND_ID, _status_check);
+                is_sent = send_local(its_target, get_client(), _header, _header_size, _data, _size, _instance, _reliable,
+                                     protocol::id_e::SEND_ID, _status_check);
 #ifdef USE_DLT
                 if (is_sent) {
-                    trace::header its_header;
-                    if (its_header.prepare(nullptr, true, _instance))
-                        tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+                    trace_message(_instance, _header, _header_size, _data, _size);
                 }
 #endif
                 return is_sent;
@@ -844,7 +912,7 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         bool send(true);
         protocol::id_e its_command(protocol::id_e::SEND_ID);
 
-        if (utility::is_notification(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
+        if (utility::is_notification(_header[VSOMEIP_MESSAGE_TYPE_POS])) {
             if (_client != VSOMEIP_ROUTING_CLIENT) {
                 its_command = protocol::id_e::NOTIFY_ONE_ID;
             } else {
@@ -856,12 +924,11 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         }
         if (send) {
             auto its_client{its_command == protocol::id_e::NOTIFY_ONE_ID ? _client : get_client()};
-            is_sent = send_local(its_target, its_client, _data, _size, _instance, _reliable, its_command, _status_check);
+            is_sent = send_local(its_target, its_client, _header, _header_size, _data, _size, _instance, _reliable, its_command,
+                                 _status_check);
 #ifdef USE_DLT
             if (is_sent && !utility::is_notification(VSOMEIP_MESSAGE_TYPE_POS) && !message_to_stub) {
-                trace::header its_header;
-                if (its_header.prepare(nullptr, true, _instance))
-                    tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
+                trace_message(_instance, _header, _header_size, _data, _size);
             }
 #endif
         }
@@ -992,9 +1059,11 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
             its_send_command.deserialize(its_buffer, its_error);
             if (its_error == protocol::error_e::ERROR_OK) {
 
+                // The message is the tail of the command, deserialize it in place
                 auto a_deserializer = get_deserializer();
-                a_deserializer->set_data(its_send_command.get_message());
-                std::shared_ptr<message_impl> its_message(a_deserializer->deserialize_message());
+                std::shared_ptr<message_impl> its_message(
+                        a_deserializer->deserialize_message(_data + _size - its_send_command.get_message_size(),
+                                                            its_send_command.get_message_size()));
                 a_deserializer->reset();
                 put_deserializer(a_deserializer);
 
@@ -2116,21 +2185,24 @@ void routing_manager_client::send_release_service(client_t _client, service_t _s
 
 bool routing_manager_client::send_pending_event_registrations(client_t _client) {
 
-    protocol::register_events_command its_command;
-    its_command.set_client(_client);
-    bool sent{true};
-
     std::scoped_lock its_lock(pending_event_registrations_mutex_);
-    auto it = pending_event_registrations_.begin();
-    while (it != pending_event_registrations_.end()) {
-        for (; it != pending_event_registrations_.end(); it++) {
-            protocol::register_event reg(it->service_, it->instance_, it->notifier_, it->type_, it->is_provided_, it->reliability_,
-                                         it->is_cyclic_, static_cast<uint16_t>(it->eventgroups_.size()), it->eventgroups_);
-            if (!its_command.add_registration(reg)) {
-                break;
-            }
-        }
+    std::vector<protocol::register_event> its_registrations;
+    for (const auto& its_pending : pending_event_registrations_) {
+        its_registrations.emplace_back(its_pending.service_, its_pending.instance_, its_pending.notifier_, its_pending.type_,
+                                       its_pending.is_provided_, its_pending.reliability_, its_pending.is_cyclic_,
+                                       static_cast<uint16_t>(its_pending.eventgroups_.size()), its_pending.eventgroups_);
+    }
+
+    // The routing manager drops commands larger than its local message size
+    std::vector<protocol::register_events_command> its_commands;
+    const bool is_complete =
+            protocol::register_events_command::split(_client, its_registrations, configuration_->get_max_message_size_local(), its_commands);
+    if (!is_complete) {
+        VSOMEIP_ERROR << "rmc::" << __func__ << " : register event command is too long.";
+    }
 
+    bool sent{is_complete};
+    for (const auto& its_command : its_commands) {
         std::vector<byte_t> its_buffer;
         protocol::error_e its_error;
         its_command.serialize(its_buffer, its_error);
@@ -2140,13 +2212,11 @@ bool routing_manager_client::send_pending_event_registrations(client_t _client)
             if (!(sender_ && sender_->send(&its_buffer[0], uint32_t(its_buffer.size())))) {
                 VSOMEIP_ERROR << "rmc::" << __func__ << " : failed to send pending registration to host";
                 sent = false;
+                break;
             }
         } else {
             VSOMEIP_ERROR << __func__ << ": register event command serialization failed (" << std::dec << int(its_error) << ")";
             sent = false;
-        }
-
-        if (!sent) {
             break;
         }
     }
@@ -2189,6 +2259,35 @@ void routing_manager_client::send_register_event(client_t _client, service_t _se
         VSOMEIP_ERROR << __func__ << ": register event command serialization failed (" << std::dec << int(its_error) << ")";
 }
 
+void routing_manager_client::send_register_events(const std::vector<protocol::register_event>& _registrations) {
+
+    // Each command is filled up to the local message size the routing manager accepts
+    std::vector<protocol::register_events_command> its_commands;
+    if (!protocol::register_events_command::split(get_client(), _registrations, configuration_->get_max_message_size_local(),
+                                                  its_commands)) {
+        VSOMEIP_ERROR << __func__ << ": register event command is too long.";
+    }
+
+    for (const auto& its_command : its_commands) {
+        std::vector<byte_t> its_buffer;
+        protocol::error_e its_error;
+        its_command.serialize(its_buffer, its_error);
+
+        if (its_error == protocol::error_e::ERROR_OK) {
+            std::scoped_lock its_sender_lock{sender_mutex_};
+            if (sender_) {
+                sender_->send(&its_buffer[0], uint32_t(its_buffer.size()));
+            }
+        } else {
+            VSOMEIP_ERROR << __func__ << ": register event command serialization failed (" << std::dec << int(its_error) << ")";
+            break;
+        }
+    }
+
+    VSOMEIP_INFO << "REGISTER EVENTS(" << std::hex << std::setfill('0') << std::setw(4) << get_client() << "): " << std::dec
+                 << _registrations.size() << " event(s)";
+}
+
 void routing_manager_client::on_subscribe_ack(client_t _client, service_t _service, instance_t _instance, eventgroup_t _eventgroup,
                                               event_t _event) {
     (void)_client;
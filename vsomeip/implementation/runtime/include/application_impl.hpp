@@ -7,6 +7,7 @@
 #define VSOMEIP_V3_APPLICATION_IMPL_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <deque>
@@ -14,6 +15,7 @@
 #include <map>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -33,7 +35,10 @@
 #include "../../configuration/include/internal.hpp"
 #endif // ANDROID
 #include "../../routing/include/routing_manager_host.hpp"
+#include "../../utility/include/free_list.hpp"
 #include "../../utility/include/service_instance_map.hpp"
+#include "dispatch_slot.hpp"
+#include "dispatcher_pool.hpp"
 
 namespace vsomeip_v3 {
 
@@ -65,6 +70,8 @@ public:
 
     VSOMEIP_EXPORT void stop_offer_event(service_t _service, instance_t _instance, event_t _event);
 
+    VSOMEIP_EXPORT void offer_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events);
+
     // Consume services / events
     VSOMEIP_EXPORT void request_service(service_t _service, instance_t _instance, major_version_t _major, minor_version_t _minor);
     VSOMEIP_EXPORT void release_service(service_t _service, instance_t _instance);
@@ -73,6 +80,8 @@ public:
                                       event_type_e _type, reliability_type_e _reliability);
     VSOMEIP_EXPORT void release_event(service_t _service, instance_t _instance, event_t _event);
 
+    VSOMEIP_EXPORT void request_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events);
+
     VSOMEIP_EXPORT void subscribe(service_t _service, instance_t _instance, eventgroup_t _eventgroup, major_version_t _major,
                                   event_t _event);
     VSOMEIP_EXPORT void subscribe_with_debounce(service_t _service, instance_t _instance, eventgroup_t _eventgroup, major_version_t _major,
@@ -195,7 +204,7 @@ public:
 
 private:
     using members_key_t = std::uint64_t;
-    using members_t = std::unordered_map<members_key_t, std::deque<message_handler_t>>;
+    using members_t = std::unordered_map<members_key_t, std::deque<std::shared_ptr<message_handler_t>>>;
 
     static members_key_t to_members_key(service_t _service, instance_t _instance, method_t _method) {
         return (static_cast<members_key_t>(_service) << 0) | (static_cast<members_key_t>(_instance) << 16)
@@ -219,6 +228,9 @@ private:
             eventgroup_id_(_eventgroup_id), handler_type_(_handler_type) { }
 
         std::function<void()> handler_;
+        // Set instead of handler_ for messages, so that the record can be reused
+        std::shared_ptr<message_handler_t> message_handler_;
+        std::shared_ptr<message> message_;
         service_t service_id_;
         instance_t instance_id_;
         method_t method_id_;
@@ -239,13 +251,25 @@ private:
     void register_availability_handler_unlocked(service_t _service, instance_t _instance, const availability_state_handler_t& _handler,
                                                 major_version_t _major, minor_version_t _minor);
 
-    void main_dispatch();
-    void dispatch();
-    void invoke_handler(std::shared_ptr<sync_handler>& _handler);
+    void main_dispatch(const std::shared_ptr<dispatch_slot<sync_handler>>& _slot);
+    void dispatch(const std::shared_ptr<dispatch_slot<sync_handler>>& _slot);
+    void pool_dispatch(std::size_t _index, const std::shared_ptr<dispatch_slot<sync_handler>>& _slot);
+    void push_handler(std::shared_ptr<sync_handler>&& _handler);
+    std::shared_ptr<sync_handler> acquire_sync_handler();
+    void release_sync_handler(std::shared_ptr<sync_handler>&& _handler);
+    // Locks handlers_mutex_ unless the dispatcher pool is used, which has its own locking
+    std::unique_lock<std::mutex> lock_handlers();
+    // Wakes a legacy dispatcher, the dispatcher pool wakes its threads on push
+    void notify_dispatcher();
+    void invoke_handler(std::shared_ptr<sync_handler>& _handler, dispatch_slot<sync_handler>& _slot);
+    void start_dispatch_monitor();
+    void monitor_dispatchers(const boost::system::error_code& _error);
+    void unblock_dispatching();
     std::shared_ptr<sync_handler> get_next_handler();
     void reschedule_availability_handler(const std::shared_ptr<sync_handler>& _handler);
     bool has_active_dispatcher();
     bool is_active_dispatcher(const std::thread::id& _id) const;
+    bool is_running_dispatcher(const std::thread::id& _id) const;
     void remove_elapsed_dispatchers();
 
     void shutdown();
@@ -267,7 +291,7 @@ private:
 
     bool is_local_endpoint(const boost::asio::ip::address& _unicast, port_t _port);
 
-    const std::deque<message_handler_t>& find_handlers(service_t _service, instance_t _instance, method_t _method) const;
+    const std::deque<std::shared_ptr<message_handler_t>>& find_handlers(service_t _service, instance_t _instance, method_t _method) const;
 
     void invoke_availability_handler(service_t _service, instance_t _instance, major_version_t _major, minor_version_t _minor);
 
@@ -322,7 +346,7 @@ private:
 
     // Method/Event (=Member) handlers
     members_t members_;
-    mutable std::mutex members_mutex_;
+    mutable std::shared_mutex members_mutex_;
 
     // Availability handlers
     using stateful_availability_t = std::pair<availability_state_handler_t, availability_state_t>;
@@ -357,9 +381,9 @@ private:
     std::map<std::thread::id, std::shared_ptr<std::thread>> dispatchers_;
     // Dispatcher threads that elapsed and can be removed
     std::set<std::thread::id> elapsed_dispatchers_;
-    // Dispatcher threads that are running
-    std::set<std::thread::id> running_dispatchers_;
-    // Mutex to protect access to dispatchers_ & elapsed_dispatchers_
+    // Handlers run by the dispatcher threads, a dispatcher is running while its slot has a handler
+    std::map<std::thread::id, std::shared_ptr<dispatch_slot<sync_handler>>> dispatch_slots_;
+    // Mutex to protect access to dispatchers_, elapsed_dispatchers_ & dispatch_slots_
     mutable std::mutex dispatcher_mutex_;
 
     // Map of promises/futures to check status of dispatcher threads
@@ -371,6 +395,20 @@ private:
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
 
+    // Periodic check of dispatch_slots_ for handlers that run longer than max_dispatch_time_
+    std::mutex dispatch_monitor_mutex_;
+    boost::asio::steady_timer dispatch_monitor_timer_;
+
+    // Message handler records that are reused instead of allocated per message, handed back
+    // from the dispatcher threads in batches
+    static constexpr std::size_t free_handlers_batch_{64};
+    free_list<std::shared_ptr<sync_handler>> free_handlers_;
+
+    // Dispatcher threads that replace main_dispatch and the dispatchers started
+    // for blocking handlers if "dispatcher_threads" is configured. The handlers of
+    // a service instance are queued in order, different instances run in parallel.
+    std::unique_ptr<dispatcher_pool<service_instance_t, std::shared_ptr<sync_handler>>> dispatcher_pool_;
+
     // Counter for dispatcher threads
     std::atomic<uint16_t> dispatcher_counter_;
     std::size_t max_detached_thread_wait_time;
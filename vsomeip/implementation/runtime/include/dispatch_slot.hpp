@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_DISPATCH_SLOT_HPP_
+#define VSOMEIP_V3_DISPATCH_SLOT_HPP_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace vsomeip_v3 {
+
+// Handler that a dispatcher thread is running. The dispatch monitor checks the slots
+// periodically and reports a handler that runs for the maximum dispatch time or longer once.
+template<class Handler_>
+class dispatch_slot {
+public:
+    void enter(const std::shared_ptr<Handler_>& _handler, std::chrono::steady_clock::time_point _now) {
+        std::scoped_lock its_lock{mutex_};
+        handler_ = _handler;
+        started_ = _now;
+        is_reported_ = false;
+    }
+
+    void leave() {
+        std::scoped_lock its_lock{mutex_};
+        handler_.reset();
+    }
+
+    bool is_running() const {
+        std::scoped_lock its_lock{mutex_};
+        return handler_ != nullptr;
+    }
+
+    // Returns the running handler if it was entered _max_time or longer before _now and was not
+    // returned yet, nullptr otherwise.
+    std::shared_ptr<Handler_> check(std::chrono::steady_clock::time_point _now, std::chrono::milliseconds _max_time) {
+        std::scoped_lock its_lock{mutex_};
+        if (!handler_ || is_reported_ || _now - started_ < _max_time) {
+            return nullptr;
+        }
+        is_reported_ = true;
+        return handler_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<Handler_> handler_;
+    std::chrono::steady_clock::time_point started_;
+    bool is_reported_{false};
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_DISPATCH_SLOT_HPP_
@@ -0,0 +1,261 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_DISPATCHER_POOL_HPP_
+#define VSOMEIP_V3_DISPATCHER_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+// Task queues of a fixed number of dispatcher threads.
+//
+// Every task has a key. The tasks of a key run one after the other in the order they were
+// pushed, tasks of different keys run in parallel. Each key has a home queue, chosen by its hash,
+// which holds its pending tasks. A queue lists the keys that have tasks and are not running; a
+// dispatcher takes the first of them from its own queue and, if that is empty, steals one from
+// the other queues. Stealing moves a key only for one task, so a single blocking task delays
+// its own key but not the others of its queue.
+//
+// An exclusive task runs alone: after all tasks pushed before it have completed and before any
+// task pushed after it starts. Until it has run, later tasks are held back in one list in push
+// order, so exclusive tasks should be rare.
+//
+// The threads are owned by the caller, which runs
+//     while (pool.pop(index, key, task)) { run(task); pool.complete(key); }
+template<class Key_, class Task_>
+class dispatcher_pool {
+public:
+    explicit dispatcher_pool(std::size_t _dispatchers) :
+        ready_count_{0}, sleepers_{0}, steal_count_{0}, is_running_{true}, active_count_{0}, is_holding_{false} {
+        for (std::size_t i = 0; i < std::max<std::size_t>(_dispatchers, 1); i++) {
+            queues_.emplace_back(std::make_unique<queue>());
+        }
+    }
+
+    std::size_t size() const { return queues_.size(); }
+
+    // Number of tasks run by another than the home dispatcher of their key
+    std::size_t get_steal_count() const { return steal_count_.load(std::memory_order_relaxed); }
+
+    void push(const Key_& _key, Task_&& _task) {
+        // Pairs with the check of active_count_ after is_holding_ was set in push_exclusive()
+        active_count_++;
+        if (is_holding_) {
+            std::unique_lock<std::mutex> its_lock{exclusive_mutex_};
+            if (is_holding_) {
+                held_.push_back(held_task{_key, std::move(_task), false});
+                its_lock.unlock();
+                leave(1);
+                return;
+            }
+        }
+        schedule(_key, std::move(_task));
+    }
+
+    void push_exclusive(const Key_& _key, Task_&& _task) {
+        std::scoped_lock its_lock{exclusive_mutex_};
+        held_.push_back(held_task{_key, std::move(_task), true});
+        is_holding_ = true;
+        advance();
+    }
+
+    // Blocks until a task is ready and takes it. Returns false once the pool is stopped. The key
+    // stays blocked until complete() is called for it.
+    bool pop(std::size_t _dispatcher, Key_& _key, Task_& _task) {
+        const std::size_t its_count{queues_.size()};
+        while (is_running_) {
+            for (std::size_t i = 0; i < its_count; i++) {
+                queue& its_queue = *queues_[(_dispatcher + i) % its_count];
+                std::scoped_lock its_lock{its_queue.mutex_};
+                if (its_queue.ready_.empty()) {
+                    continue;
+                }
+                _key = its_queue.ready_.front();
+                its_queue.ready_.pop_front();
+                ready_count_--;
+
+                auto& its_tasks = its_queue.strands_[_key].tasks_;
+                _task = std::move(its_tasks.front());
+                its_tasks.pop_front();
+                if (i > 0) {
+                    steal_count_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+
+            std::unique_lock<std::mutex> its_lock{sleep_mutex_};
+            sleepers_++;
+            sleep_condition_.wait(its_lock, [this] { return !is_running_ || ready_count_ > 0; });
+            sleepers_--;
+        }
+        return false;
+    }
+
+    // Releases the key of a task returned by pop(), its next task becomes ready.
+    void complete(const Key_& _key) {
+        queue& its_home = home_of(_key);
+        bool is_ready{false};
+        {
+            std::scoped_lock its_lock{its_home.mutex_};
+            auto found_strand = its_home.strands_.find(_key);
+            if (found_strand != its_home.strands_.end()) {
+                if (found_strand->second.tasks_.empty()) {
+                    // Kept for the next task of the key, so that pushing it does not allocate
+                    found_strand->second.is_scheduled_ = false;
+                } else {
+                    its_home.ready_.push_back(_key);
+                    ready_count_++;
+                    is_ready = true;
+                }
+            }
+        }
+        if (is_ready) {
+            wake_one();
+        }
+        leave(1);
+    }
+
+    // Makes pop() return false. Pending tasks are kept for the next start().
+    void stop() {
+        std::scoped_lock its_lock{sleep_mutex_};
+        is_running_ = false;
+        sleep_condition_.notify_all();
+    }
+
+    void start() {
+        std::scoped_lock its_lock{sleep_mutex_};
+        is_running_ = true;
+    }
+
+    // Drops all pending and held tasks. Tasks that are running are completed as usual.
+    void clear() {
+        std::size_t its_dropped{0};
+        for (auto& its_queue : queues_) {
+            std::scoped_lock its_lock{its_queue->mutex_};
+            for (auto it = its_queue->strands_.begin(); it != its_queue->strands_.end();) {
+                its_dropped += it->second.tasks_.size();
+                it->second.tasks_.clear();
+                if (!it->second.is_scheduled_
+                    || std::find(its_queue->ready_.begin(), its_queue->ready_.end(), it->first) != its_queue->ready_.end()) {
+                    it = its_queue->strands_.erase(it);
+                } else {
+                    ++it; // running, removed by complete()
+                }
+            }
+            ready_count_ -= its_queue->ready_.size();
+            its_queue->ready_.clear();
+        }
+        {
+            std::scoped_lock its_lock{exclusive_mutex_};
+            held_.clear();
+        }
+        leave(its_dropped);
+    }
+
+private:
+    struct strand {
+        std::deque<Task_> tasks_;
+        bool is_scheduled_{false}; // ready or running
+    };
+
+    struct queue {
+        std::mutex mutex_;
+        std::unordered_map<Key_, strand> strands_; // keys with this home that had tasks
+        std::deque<Key_> ready_;
+    };
+
+    struct held_task {
+        Key_ key_;
+        Task_ task_;
+        bool is_exclusive_;
+    };
+
+    queue& home_of(const Key_& _key) { return *queues_[std::hash<Key_>{}(_key) % queues_.size()]; }
+
+    void schedule(const Key_& _key, Task_&& _task) {
+        queue& its_home = home_of(_key);
+        bool is_ready{false};
+        {
+            std::scoped_lock its_lock{its_home.mutex_};
+            auto& its_strand = its_home.strands_[_key];
+            its_strand.tasks_.push_back(std::move(_task));
+            if (!its_strand.is_scheduled_) {
+                its_strand.is_scheduled_ = true;
+                its_home.ready_.push_back(_key);
+                ready_count_++;
+                is_ready = true;
+            }
+        }
+        if (is_ready) {
+            wake_one();
+        }
+    }
+
+    // Ends _count tasks that were counted in active_count_. The last one lets the held tasks go on.
+    void leave(std::size_t _count) {
+        if (active_count_.fetch_sub(_count) == _count && is_holding_) {
+            std::scoped_lock its_lock{exclusive_mutex_};
+            advance();
+        }
+    }
+
+    // Called with exclusive_mutex_ locked. Once no task is active, schedules the held tasks up to
+    // the next exclusive one, or that one alone if it is first.
+    void advance() {
+        if (active_count_ != 0 || !is_holding_) {
+            return;
+        }
+        while (!held_.empty() && !held_.front().is_exclusive_) {
+            active_count_++;
+            schedule(held_.front().key_, std::move(held_.front().task_));
+            held_.pop_front();
+        }
+        if (held_.empty()) {
+            is_holding_ = false;
+        } else if (active_count_ == 0) {
+            active_count_++;
+            schedule(held_.front().key_, std::move(held_.front().task_));
+            held_.pop_front();
+        }
+    }
+
+    void wake_one() {
+        // Pairs with the check of ready_count_ after sleepers_ was incremented in pop()
+        if (sleepers_ > 0) {
+            std::scoped_lock its_lock{sleep_mutex_};
+            sleep_condition_.notify_one();
+        }
+    }
+
+    std::vector<std::unique_ptr<queue>> queues_;
+    std::atomic<std::size_t> ready_count_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::atomic<std::size_t> sleepers_;
+    std::atomic<std::size_t> steal_count_;
+    std::atomic<bool> is_running_;
+
+    // Tasks pushed and not completed yet, without the held ones
+    std::atomic<std::size_t> active_count_;
+    // Set from the push of an exclusive task until it has run and the tasks behind it are scheduled
+    std::atomic<bool> is_holding_;
+    std::mutex exclusive_mutex_;
+    std::deque<held_task> held_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_DISPATCHER_POOL_HPP_
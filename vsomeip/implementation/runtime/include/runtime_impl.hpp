@@ -32,6 +32,7 @@ public:
     std::shared_ptr<payload> create_payload() const;
     std::shared_ptr<payload> create_payload(const byte_t* _data, uint32_t _size) const;
     std::shared_ptr<payload> create_payload(const std::vector<byte_t>& _data) const;
+    std::shared_ptr<payload> create_external_payload(const byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner) const;
 
     std::shared_ptr<application> get_application(const std::string& _name) const;
 
@@ -32,6 +32,7 @@
 #include "../../configuration/include/configuration_plugin.hpp"
 #endif // VSOMEIP_ENABLE_MULTIPLE_ROUTING_MANAGERS
 #include "../../endpoints/include/endpoint.hpp"
+#include "../../message/include/message_pool.hpp"
 #include "../../message/include/serializer.hpp"
 #include "../../plugin/include/plugin_manager_impl.hpp"
 #include "../../routing/include/routing_manager_impl.hpp"
@@ -57,8 +58,8 @@ application_impl::application_impl(const std::string& _name, const std::string&
     signals_{io_, SIGINT, SIGTERM}, catched_signal_{false},
 #endif
     is_dispatching_{false}, max_dispatchers_{VSOMEIP_DEFAULT_MAX_DISPATCHERS}, max_dispatch_time_{VSOMEIP_DEFAULT_MAX_DISPATCH_TIME},
-    dispatcher_counter_{0}, max_detached_thread_wait_time{VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS}, stopped_{false},
-    block_stop_condition_{false}, is_routing_manager_host_{false}, stopped_called_{false}, watchdog_timer_{io_},
+    dispatch_monitor_timer_{io_}, dispatcher_counter_{0}, max_detached_thread_wait_time{VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS},
+    stopped_{false}, block_stop_condition_{false}, is_routing_manager_host_{false}, stopped_called_{false}, watchdog_timer_{io_},
     client_side_logging_{false}, has_session_handling_{true} {
 }
 
@@ -107,6 +108,7 @@ application_impl::~application_impl() {
             }
         }
         dispatchers_.clear();
+        dispatch_slots_.clear();
     } catch (const std::exception& e) {
         std::cerr << __func__ << " catched exception (dispatchers): " << e.what() << std::endl;
     }
@@ -250,6 +252,19 @@ bool application_impl::init() {
         max_dispatch_time_ = its_configuration->get_max_dispatch_time(name_);
         max_detached_thread_wait_time = its_configuration->get_max_detached_thread_wait_time(name_);
 
+        // The pool is shared by all applications of the process, the largest capacity wins
+        auto its_message_pool_capacity = its_configuration->get_message_pool_capacity(name_);
+        if (its_message_pool_capacity > message_pool::get_capacity()) {
+            message_pool::set_capacity(its_message_pool_capacity);
+            VSOMEIP_INFO << "application: " << name_ << " pools " << std::dec << its_message_pool_capacity << " messages per thread";
+        }
+
+        auto its_dispatcher_threads = its_configuration->get_dispatcher_threads(name_);
+        if (its_dispatcher_threads > 0) {
+            dispatcher_pool_ = std::make_unique<dispatcher_pool<service_instance_t, std::shared_ptr<sync_handler>>>(its_dispatcher_threads);
+            VSOMEIP_INFO << "application: " << name_ << " dispatches handlers on " << std::dec << its_dispatcher_threads << " threads";
+        }
+
         has_session_handling_ = its_configuration->has_session_handling(name_);
         if (!has_session_handling_)
             VSOMEIP_INFO << "application: " << name_ << " has session handling switched off!";
@@ -400,15 +415,35 @@ void application_impl::start() {
             std::scoped_lock its_lock_inner{dispatcher_mutex_};
             is_dispatching_ = true;
             elapse_unactive_dispatchers_ = false;
-            std::packaged_task<void()> dispatcher_task_(std::bind(&application_impl::main_dispatch, shared_from_this()));
-            std::future<void> dispatcher_future_ = dispatcher_task_.get_future();
-            auto its_main_dispatcher = std::make_shared<std::thread>(std::move(dispatcher_task_));
+            if (dispatcher_pool_) {
+                dispatcher_pool_->start();
+                for (std::size_t i = 0; i < dispatcher_pool_->size(); i++) {
+                    auto its_slot = std::make_shared<dispatch_slot<sync_handler>>();
+                    std::packaged_task<void()> dispatcher_task_(
+                            std::bind(&application_impl::pool_dispatch, shared_from_this(), i, its_slot));
+                    std::future<void> dispatcher_future_ = dispatcher_task_.get_future();
+                    auto its_dispatcher = std::make_shared<std::thread>(std::move(dispatcher_task_));
+
+                    dispatchers_control_[its_dispatcher->get_id()] = std::move(dispatcher_future_);
+
+                    dispatchers_[its_dispatcher->get_id()] = its_dispatcher;
+                    dispatch_slots_[its_dispatcher->get_id()] = its_slot;
+                    increment_active_threads();
+                }
+            } else {
+                auto its_slot = std::make_shared<dispatch_slot<sync_handler>>();
+                std::packaged_task<void()> dispatcher_task_(std::bind(&application_impl::main_dispatch, shared_from_this(), its_slot));
+                std::future<void> dispatcher_future_ = dispatcher_task_.get_future();
+                auto its_main_dispatcher = std::make_shared<std::thread>(std::move(dispatcher_task_));
 
-            dispatchers_control_[its_main_dispatcher->get_id()] = std::move(dispatcher_future_);
+                dispatchers_control_[its_main_dispatcher->get_id()] = std::move(dispatcher_future_);
 
-            dispatchers_[its_main_dispatcher->get_id()] = its_main_dispatcher;
-            increment_active_threads();
+                dispatchers_[its_main_dispatcher->get_id()] = its_main_dispatcher;
+                dispatch_slots_[its_main_dispatcher->get_id()] = its_slot;
+                increment_active_threads();
+            }
         }
+        start_dispatch_monitor();
 
         if (stop_thread_.joinable()) {
             stop_thread_.join();
@@ -842,7 +877,9 @@ void application_impl::notify(service_t _service, instance_t _instance, event_t
                               bool _force) const {
 
     if (routing_) {
-        auto its_payload{runtime::get()->create_payload(_payload->get_data(), _payload->get_length())};
+        // Read through a const reference to not force a copy of externally referenced data
+        const payload& its_source{*_payload};
+        auto its_payload{runtime::get()->create_payload(its_source.get_data(), its_source.get_length())};
         routing_->notify(_service, _instance, _event, its_payload, _force);
     }
 }
@@ -850,7 +887,9 @@ void application_impl::notify(service_t _service, instance_t _instance, event_t
 void application_impl::notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                   client_t _client, bool _force) const {
     if (routing_) {
-        auto its_payload{runtime::get()->create_payload(_payload->get_data(), _payload->get_length())};
+        // Read through a const reference to not force a copy of externally referenced data
+        const payload& its_source{*_payload};
+        auto its_payload{runtime::get()->create_payload(its_source.get_data(), its_source.get_length())};
         routing_->notify_one(_service, _instance, _event, its_payload, _client, _force
 #ifdef VSOMEIP_ENABLE_COMPAT
                              ,
@@ -912,14 +951,14 @@ void application_impl::invoke_availability_handler(service_t _service, instance_
                         auto its_handler{found_minor->second.first};
                         set_availability_state(found_minor->second.second, _service, _instance, _major, _minor, its_state);
 
-                        std::scoped_lock handlers_lock{handlers_mutex_};
+                        auto handlers_lock{lock_handlers()};
                         auto its_sync_handler = std::make_shared<sync_handler>(
                                 [its_handler, _service, _instance, its_state]() { its_handler(_service, _instance, its_state); });
                         its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
                         its_sync_handler->service_id_ = _service;
                         its_sync_handler->instance_id_ = _instance;
-                        handlers_.push_back(its_sync_handler);
-                        dispatcher_condition_.notify_one();
+                        push_handler(std::move(its_sync_handler));
+                        notify_dispatcher();
                     }
                 }
             }
@@ -943,10 +982,10 @@ void application_impl::register_availability_handler_unlocked(service_t _service
         its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
         its_sync_handler->service_id_ = _srvc;
         its_sync_handler->instance_id_ = _nstnc;
-        handlers_.push_back(its_sync_handler);
+        push_handler(std::move(its_sync_handler));
     };
 
-    std::scoped_lock handlers_lock(handlers_mutex_);
+    auto handlers_lock{lock_handlers()};
     if (_service != ANY_SERVICE && _instance != ANY_INSTANCE) {
         add_sync_handler(_service, _instance, _handler, its_state);
     } else {
@@ -960,7 +999,7 @@ void application_impl::register_availability_handler_unlocked(service_t _service
         }
     }
     // trigger dispatching
-    dispatcher_condition_.notify_one();
+    notify_dispatcher();
 }
 
 void application_impl::unregister_availability_handler(service_t _service, instance_t _instance, major_version_t _major,
@@ -1266,7 +1305,7 @@ void application_impl::deliver_subscription_state(service_t _service, instance_t
         }
     }
     {
-        std::unique_lock<std::mutex> handlers_lock(handlers_mutex_);
+        auto handlers_lock{lock_handlers()};
         for (auto& handler : handlers) {
             auto its_sync_handler = std::make_shared<sync_handler>([handler, _service, _instance, _eventgroup, _event, _error]() {
                 handler(_service, _instance, _eventgroup, _event, _error);
@@ -1276,10 +1315,10 @@ void application_impl::deliver_subscription_state(service_t _service, instance_t
             its_sync_handler->instance_id_ = _instance;
             its_sync_handler->method_id_ = _event;
             its_sync_handler->eventgroup_id_ = _eventgroup;
-            handlers_.push_back(its_sync_handler);
+            push_handler(std::move(its_sync_handler));
         }
         if (handlers.size()) {
-            dispatcher_condition_.notify_one();
+            notify_dispatcher();
         }
     }
 }
@@ -1352,6 +1391,22 @@ void application_impl::offer_event(service_t _service, instance_t _instance, eve
     }
 }
 
+void application_impl::offer_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events) {
+    if (routing_) {
+        std::vector<event_registration_t> its_events(_events);
+        for (auto& its_event : its_events) {
+            if (its_event.cycle_ == std::chrono::milliseconds::zero() && its_event.change_resets_cycle_ == false
+                && its_event.update_on_change_ == true) {
+
+                configuration_->get_event_update_properties(_service, _instance, its_event.event_, its_event.cycle_,
+                                                            its_event.change_resets_cycle_, its_event.update_on_change_);
+            }
+        }
+
+        routing_->register_events(client_, _service, _instance, its_events, true);
+    }
+}
+
 void application_impl::stop_offer_event(service_t _service, instance_t _instance, event_t _event) {
     if (routing_)
         routing_->unregister_event(client_, _service, _instance, _event, true);
@@ -1364,6 +1419,19 @@ void application_impl::request_event(service_t _service, instance_t _instance, e
                                  false, true, nullptr, false);
 }
 
+void application_impl::request_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events) {
+    if (routing_) {
+        std::vector<event_registration_t> its_events(_events);
+        for (auto& its_event : its_events) {
+            its_event.cycle_ = std::chrono::milliseconds::zero();
+            its_event.change_resets_cycle_ = false;
+            its_event.update_on_change_ = true;
+        }
+
+        routing_->register_events(client_, _service, _instance, its_events, false);
+    }
+}
+
 void application_impl::release_event(service_t _service, instance_t _instance, event_t _event) {
     if (routing_)
         routing_->unregister_event(client_, _service, _instance, _event, false);
@@ -1438,11 +1506,11 @@ void application_impl::on_state(state_type_e _state) {
         }
     }
     if (has_state_handler) {
-        std::scoped_lock its_lock{handlers_mutex_};
+        auto its_lock{lock_handlers()};
         auto its_sync_handler = std::make_shared<sync_handler>([handler, _state]() { handler(_state); });
         its_sync_handler->handler_type_ = handler_type_e::STATE;
-        handlers_.push_back(its_sync_handler);
-        dispatcher_condition_.notify_one();
+        push_handler(std::move(its_sync_handler));
+        notify_dispatcher();
     }
 }
 
@@ -1558,14 +1626,14 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
             }
         }
         {
-            std::scoped_lock handlers_lock{handlers_mutex_};
+            auto handlers_lock{lock_handlers()};
             for (const auto& handler : its_handlers) {
                 auto its_sync_handler =
                         std::make_shared<sync_handler>([handler, _service, _instance, _state]() { handler(_service, _instance, _state); });
                 its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
                 its_sync_handler->service_id_ = _service;
                 its_sync_handler->instance_id_ = _instance;
-                handlers_.push_back(its_sync_handler);
+                push_handler(std::move(its_sync_handler));
             }
         }
     }
@@ -1600,13 +1668,14 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
         }
     }
 
-    if (its_handlers.size()) {
+    if (its_handlers.size() && !dispatcher_pool_) {
         std::scoped_lock handlers_lock{handlers_mutex_};
         dispatcher_condition_.notify_one();
     }
 }
 
-const std::deque<message_handler_t>& application_impl::find_handlers(service_t _service, instance_t _instance, method_t _method) const {
+const std::deque<std::shared_ptr<message_handler_t>>& application_impl::find_handlers(service_t _service, instance_t _instance,
+                                                                                      method_t _method) const {
 
     // The (ordered!) sequence of queries to attempt
     const std::array<members_key_t, 8> queries{
@@ -1622,7 +1691,7 @@ const std::deque<message_handler_t>& application_impl::find_handlers(service_t _
         }
     }
 
-    static const std::deque<message_handler_t> empty;
+    static const std::deque<std::shared_ptr<message_handler_t>> empty;
     return empty;
 }
 
@@ -1641,22 +1710,24 @@ void application_impl::on_message(std::shared_ptr<message>&& _message) {
     }
 
     {
-        std::scoped_lock its_lock{members_mutex_};
+        std::shared_lock its_lock{members_mutex_};
 
-        const auto its_handlers = find_handlers(its_service, its_instance, its_method);
+        const auto& its_handlers = find_handlers(its_service, its_instance, its_method);
 
         if (its_handlers.size()) {
-            std::scoped_lock its_lock_inner{handlers_mutex_};
+            auto its_handlers_lock{lock_handlers()};
             for (const auto& handler : its_handlers) {
-                auto its_sync_handler = std::make_shared<sync_handler>([handler, _message]() { handler(_message); });
+                auto its_sync_handler = acquire_sync_handler();
+                its_sync_handler->message_handler_ = handler;
+                its_sync_handler->message_ = _message;
                 its_sync_handler->handler_type_ = handler_type_e::MESSAGE;
                 its_sync_handler->service_id_ = _message->get_service();
                 its_sync_handler->instance_id_ = _message->get_instance();
                 its_sync_handler->method_id_ = _message->get_method();
                 its_sync_handler->session_id_ = _message->get_session();
-                handlers_.push_back(its_sync_handler);
+                push_handler(std::move(its_sync_handler));
             }
-            dispatcher_condition_.notify_one();
+            notify_dispatcher();
         }
     }
 }
@@ -1666,7 +1737,7 @@ routing_manager* application_impl::get_routing_manager() const {
     return routing_.get();
 }
 
-void application_impl::main_dispatch() {
+void application_impl::main_dispatch(const std::shared_ptr<dispatch_slot<sync_handler>>& _slot) {
     utility::set_thread_niceness(configuration_->get_io_thread_nice_level(name_));
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     {
@@ -1696,7 +1767,7 @@ void application_impl::main_dispatch() {
             std::shared_ptr<sync_handler> its_handler;
             while (is_dispatching_ && is_active_dispatcher(its_id) && (its_handler = get_next_handler())) {
                 its_lock.unlock();
-                invoke_handler(its_handler);
+                invoke_handler(its_handler, *_slot);
 
                 if (!is_dispatching_)
                     return;
@@ -1704,6 +1775,7 @@ void application_impl::main_dispatch() {
                 its_lock.lock();
 
                 reschedule_availability_handler(its_handler);
+                release_sync_handler(std::move(its_handler));
                 remove_elapsed_dispatchers();
 
 #ifdef _WIN32
@@ -1717,7 +1789,79 @@ void application_impl::main_dispatch() {
     }
 }
 
-void application_impl::dispatch() {
+void application_impl::pool_dispatch(std::size_t _index, const std::shared_ptr<dispatch_slot<sync_handler>>& _slot) {
+    utility::set_thread_niceness(configuration_->get_io_thread_nice_level(name_));
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+    {
+        std::stringstream s;
+        s << std::hex << std::setfill('0') << std::setw(4) << client_ << "_p_dispatch";
+        pthread_setname_np(pthread_self(), s.str().c_str());
+    }
+#endif
+    VSOMEIP_INFO << "pool dispatch thread " << std::dec << _index << " id from application: " << std::hex << std::setfill('0')
+                 << std::setw(4) << client_ << " (" << name_ << ") is: " << std::hex << std::this_thread::get_id()
+#if defined(__linux__) || defined(ANDROID)
+                 << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
+#endif
+            ;
+    service_instance_t its_key{ANY_SERVICE, ANY_INSTANCE};
+    std::shared_ptr<sync_handler> its_handler;
+    while (is_dispatching_ && dispatcher_pool_->pop(_index, its_key, its_handler)) {
+        invoke_handler(its_handler, *_slot);
+        release_sync_handler(std::move(its_handler));
+        dispatcher_pool_->complete(its_key);
+    }
+}
+
+void application_impl::push_handler(std::shared_ptr<sync_handler>&& _handler) {
+    if (dispatcher_pool_) {
+        service_instance_t its_key{_handler->service_id_, _handler->instance_id_};
+        if (_handler->service_id_ == ANY_SERVICE && _handler->instance_id_ == ANY_INSTANCE) {
+            // State, watchdog and offered services handlers keep their place in the order of
+            // all handlers, as with the single dispatcher
+            dispatcher_pool_->push_exclusive(its_key, std::move(_handler));
+        } else {
+            dispatcher_pool_->push(its_key, std::move(_handler));
+        }
+    } else {
+        // handlers_mutex_ is locked by the caller
+        handlers_.push_back(std::move(_handler));
+    }
+}
+
+std::unique_lock<std::mutex> application_impl::lock_handlers() {
+    if (dispatcher_pool_) {
+        return std::unique_lock<std::mutex>{handlers_mutex_, std::defer_lock};
+    }
+    return std::unique_lock<std::mutex>{handlers_mutex_};
+}
+
+void application_impl::notify_dispatcher() {
+    if (!dispatcher_pool_) {
+        dispatcher_condition_.notify_one();
+    }
+}
+
+std::shared_ptr<application_impl::sync_handler> application_impl::acquire_sync_handler() {
+    auto its_handler = free_handlers_.acquire();
+    if (!its_handler) {
+        its_handler = std::make_shared<sync_handler>(nullptr);
+    }
+    return its_handler;
+}
+
+void application_impl::release_sync_handler(std::shared_ptr<sync_handler>&& _handler) {
+    // Only message records are reused, their callable is not type-erased into handler_
+    if (!_handler || _handler->handler_type_ != handler_type_e::MESSAGE || _handler.use_count() > 1) {
+        _handler.reset();
+        return;
+    }
+    _handler->message_handler_.reset();
+    _handler->message_.reset();
+    free_handlers_.release(std::move(_handler), free_handlers_batch_);
+}
+
+void application_impl::dispatch(const std::shared_ptr<dispatch_slot<sync_handler>>& _slot) {
 #if defined(__linux__) || defined(ANDROID)
     {
         std::stringstream s;
@@ -1750,7 +1894,7 @@ void application_impl::dispatch() {
             std::shared_ptr<sync_handler> its_handler;
             while (is_dispatching_ && is_active_dispatcher(its_id) && (its_handler = get_next_handler())) {
                 its_lock.unlock();
-                invoke_handler(its_handler);
+                invoke_handler(its_handler, *_slot);
 
                 if (!is_dispatching_)
                     return;
@@ -1758,6 +1902,7 @@ void application_impl::dispatch() {
                 its_lock.lock();
 
                 reschedule_availability_handler(its_handler);
+                release_sync_handler(std::move(its_handler));
                 remove_elapsed_dispatchers();
             }
         }
@@ -1826,92 +1971,120 @@ void application_impl::reschedule_availability_handler(const std::shared_ptr<syn
     }
 }
 
-void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler) {
+void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler, dispatch_slot<sync_handler>& _slot) {
     const std::thread::id its_id = std::this_thread::get_id();
 
-    auto its_sync_handler = std::make_shared<sync_handler>(_handler->service_id_, _handler->instance_id_, _handler->method_id_,
-                                                           _handler->session_id_, _handler->eventgroup_id_, _handler->handler_type_);
-
-    boost::asio::steady_timer its_dispatcher_timer(io_);
-    its_dispatcher_timer.expires_after(std::chrono::milliseconds(max_dispatch_time_));
-    its_dispatcher_timer.async_wait([this, its_sync_handler](const boost::system::error_code& _error) {
-        if (!_error) {
-            print_blocking_call(its_sync_handler);
-            if (has_active_dispatcher()) {
-                std::scoped_lock its_lock{handlers_mutex_};
-                dispatcher_condition_.notify_all();
-            } else {
-                // If possible, create a new dispatcher thread to unblock.
-                // If this is _not_ possible, dispatching is blocked until
-                // at least one of the active handler calls returns.
-                while (is_dispatching_) {
-                    if (dispatcher_mutex_.try_lock()) {
-                        if (dispatchers_.size() < max_dispatchers_) {
-                            if (is_dispatching_) {
-                                std::packaged_task<void()> dispatcher_task_(std::bind(&application_impl::dispatch, shared_from_this()));
-                                std::future<void> dispatcher_future_ = dispatcher_task_.get_future();
-                                auto its_dispatcher = std::make_shared<std::thread>(std::move(dispatcher_task_));
-
-                                dispatchers_control_[its_dispatcher->get_id()] = std::move(dispatcher_future_);
-
-                                dispatchers_[its_dispatcher->get_id()] = its_dispatcher;
-                                increment_active_threads();
-                            } else {
-                                VSOMEIP_INFO << "Won't start new dispatcher "
-                                                "thread as Client="
-                                             << std::hex << get_client() << " is shutting down";
-                            }
-                        } else {
-                            VSOMEIP_ERROR << "Maximum number of dispatchers exceeded. Configuration: "
-                                          << " Max dispatchers: " << std::dec << max_dispatchers_ << " Max dispatch time: " << std::dec
-                                          << max_dispatch_time_;
-                        }
-                        dispatcher_mutex_.unlock();
-                        break;
-                    } else {
-                        std::this_thread::yield();
-                    }
-                }
-            }
-        }
-    });
+    _slot.enter(_handler, std::chrono::steady_clock::now());
     if (client_side_logging_
         && (client_side_logging_filter_.empty()
-            || (1 == client_side_logging_filter_.count(std::make_tuple(its_sync_handler->service_id_, ANY_INSTANCE)))
-            || (1 == client_side_logging_filter_.count(std::make_tuple(its_sync_handler->service_id_, its_sync_handler->instance_id_))))) {
+            || (1 == client_side_logging_filter_.count(std::make_tuple(_handler->service_id_, ANY_INSTANCE)))
+            || (1 == client_side_logging_filter_.count(std::make_tuple(_handler->service_id_, _handler->instance_id_))))) {
         VSOMEIP_INFO << "Invoking handler: (" << std::hex << std::setfill('0') << std::setw(4) << client_ << "): [" << std::setw(4)
-                     << its_sync_handler->service_id_ << "." << std::setw(4) << its_sync_handler->instance_id_ << "." << std::setw(4)
-                     << its_sync_handler->method_id_ << ":" << std::setw(4) << its_sync_handler->session_id_ << "] "
-                     << "type=" << static_cast<std::uint32_t>(its_sync_handler->handler_type_) << " thread=" << std::hex << its_id;
+                     << _handler->service_id_ << "." << std::setw(4) << _handler->instance_id_ << "." << std::setw(4)
+                     << _handler->method_id_ << ":" << std::setw(4) << _handler->session_id_ << "] "
+                     << "type=" << static_cast<std::uint32_t>(_handler->handler_type_) << " thread=" << std::hex << its_id;
+    }
+
+    if (is_dispatching_) {
+        try {
+            if (_handler->message_handler_) {
+                (*_handler->message_handler_)(_handler->message_);
+            } else {
+                _handler->handler_();
+            }
+        } catch (const std::exception& e) {
+            VSOMEIP_ERROR << "application_impl::invoke_handler caught exception: " << e.what();
+            print_blocking_call(_handler);
+        }
+    }
+
+    _slot.leave();
+}
+
+void application_impl::start_dispatch_monitor() {
+    std::scoped_lock its_lock{dispatch_monitor_mutex_};
+    if (is_dispatching_) {
+        dispatch_monitor_timer_.expires_after(std::chrono::milliseconds(std::max<std::size_t>(max_dispatch_time_ / 2, 1)));
+        dispatch_monitor_timer_.async_wait([weak_self = weak_from_this()](const boost::system::error_code& _error) {
+            if (auto its_self = weak_self.lock()) {
+                its_self->monitor_dispatchers(_error);
+            }
+        });
     }
+}
 
+void application_impl::monitor_dispatchers(const boost::system::error_code& _error) {
+    if (_error) {
+        return;
+    }
+
+    const auto its_now = std::chrono::steady_clock::now();
+    std::size_t its_blocked{0};
     while (is_dispatching_) {
         if (dispatcher_mutex_.try_lock()) {
-            running_dispatchers_.insert(its_id);
+            for (const auto& [its_id, its_slot] : dispatch_slots_) {
+                auto its_handler = its_slot->check(its_now, std::chrono::milliseconds(max_dispatch_time_));
+                if (its_handler) {
+                    print_blocking_call(its_handler);
+                    its_blocked++;
+                }
+            }
             dispatcher_mutex_.unlock();
             break;
         }
         std::this_thread::yield();
     }
 
-    if (is_dispatching_) {
-        try {
-            _handler->handler_();
-        } catch (const std::exception& e) {
-            VSOMEIP_ERROR << "application_impl::invoke_handler caught exception: " << e.what();
-            print_blocking_call(its_sync_handler);
+    // With the dispatcher pool, only the handlers of the blocked service
+    // instance wait, the other pool threads keep dispatching.
+    if (!dispatcher_pool_) {
+        for (; its_blocked > 0; its_blocked--) {
+            unblock_dispatching();
         }
     }
 
-    its_dispatcher_timer.cancel();
+    start_dispatch_monitor();
+}
+
+void application_impl::unblock_dispatching() {
+    if (has_active_dispatcher()) {
+        std::scoped_lock its_lock{handlers_mutex_};
+        dispatcher_condition_.notify_all();
+        return;
+    }
 
+    // If possible, create a new dispatcher thread to unblock.
+    // If this is _not_ possible, dispatching is blocked until
+    // at least one of the active handler calls returns.
     while (is_dispatching_) {
         if (dispatcher_mutex_.try_lock()) {
-            running_dispatchers_.erase(its_id);
+            if (dispatchers_.size() < max_dispatchers_) {
+                if (is_dispatching_) {
+                    auto its_slot = std::make_shared<dispatch_slot<sync_handler>>();
+                    std::packaged_task<void()> dispatcher_task_(std::bind(&application_impl::dispatch, shared_from_this(), its_slot));
+                    std::future<void> dispatcher_future_ = dispatcher_task_.get_future();
+                    auto its_dispatcher = std::make_shared<std::thread>(std::move(dispatcher_task_));
+
+                    dispatchers_control_[its_dispatcher->get_id()] = std::move(dispatcher_future_);
+
+                    dispatchers_[its_dispatcher->get_id()] = its_dispatcher;
+                    dispatch_slots_[its_dispatcher->get_id()] = its_slot;
+                    increment_active_threads();
+                } else {
+                    VSOMEIP_INFO << "Won't start new dispatcher "
+                                    "thread as Client="
+                                 << std::hex << get_client() << " is shutting down";
+                }
+            } else {
+                VSOMEIP_ERROR << "Maximum number of dispatchers exceeded. Configuration: "
+                              << " Max dispatchers: " << std::dec << max_dispatchers_ << " Max dispatch time: " << std::dec
+                              << max_dispatch_time_;
+            }
             dispatcher_mutex_.unlock();
-            return;
+            break;
+        } else {
+            std::this_thread::yield();
         }
-        std::this_thread::yield();
     }
 }
 
@@ -1919,8 +2092,7 @@ bool application_impl::has_active_dispatcher() {
     while (is_dispatching_) {
         if (dispatcher_mutex_.try_lock()) {
             for (const auto& d : dispatchers_) {
-                if (running_dispatchers_.find(d.first) == running_dispatchers_.end()
-                    && elapsed_dispatchers_.find(d.first) == elapsed_dispatchers_.end()) {
+                if (!is_running_dispatcher(d.first) && elapsed_dispatchers_.find(d.first) == elapsed_dispatchers_.end()) {
                     dispatcher_mutex_.unlock();
                     return true;
                 }
@@ -1937,8 +2109,7 @@ bool application_impl::is_active_dispatcher(const std::thread::id& _id) const {
     while (is_dispatching_) {
         if (dispatcher_mutex_.try_lock()) {
             for (const auto& d : dispatchers_) {
-                if (d.first != _id && running_dispatchers_.find(d.first) == running_dispatchers_.end()
-                    && elapsed_dispatchers_.find(d.first) == elapsed_dispatchers_.end()) {
+                if (d.first != _id && !is_running_dispatcher(d.first) && elapsed_dispatchers_.find(d.first) == elapsed_dispatchers_.end()) {
                     dispatcher_mutex_.unlock();
                     return false;
                 }
@@ -1951,6 +2122,15 @@ bool application_impl::is_active_dispatcher(const std::thread::id& _id) const {
     return false;
 }
 
+bool application_impl::is_running_dispatcher(const std::thread::id& _id) const {
+    // dispatcher_mutex_ is locked by the caller
+    auto found_slot = dispatch_slots_.find(_id);
+    if (found_slot == dispatch_slots_.end()) {
+        return false;
+    }
+    return found_slot->second->is_running();
+}
+
 void application_impl::remove_elapsed_dispatchers() {
     if (is_dispatching_) {
         std::scoped_lock its_lock{dispatcher_mutex_};
@@ -1962,6 +2142,7 @@ void application_impl::remove_elapsed_dispatchers() {
             }
 
             dispatchers_.erase(id);
+            dispatch_slots_.erase(id);
         }
         elapsed_dispatchers_.clear();
     }
@@ -1991,6 +2172,9 @@ void application_impl::clear_all_handler() {
     {
         std::scoped_lock its_lock{handlers_mutex_};
         handlers_.clear();
+        if (dispatcher_pool_) {
+            dispatcher_pool_->clear();
+        }
     }
 }
 
@@ -2019,6 +2203,13 @@ void application_impl::shutdown() {
         is_dispatching_ = false;
         dispatcher_condition_.notify_all();
     }
+    if (dispatcher_pool_) {
+        dispatcher_pool_->stop();
+    }
+    {
+        std::scoped_lock its_lock{dispatch_monitor_mutex_};
+        dispatch_monitor_timer_.cancel();
+    }
 
     try {
         std::scoped_lock its_lock{dispatcher_mutex_};
@@ -2045,9 +2236,9 @@ void application_impl::shutdown() {
             }
         }
         availability_handlers_.clear();
-        running_dispatchers_.clear();
         elapsed_dispatchers_.clear();
         dispatchers_.clear();
+        dispatch_slots_.clear();
     } catch (const std::exception& e) {
         VSOMEIP_ERROR << "application_impl::" << __func__ << ": stopping dispatchers, "
                       << " catched exception: " << e.what();
@@ -2409,11 +2600,11 @@ void application_impl::on_offered_services_info(std::vector<std::pair<service_t,
         }
     }
     if (has_offered_services_handler) {
-        std::scoped_lock its_lock{handlers_mutex_};
+        auto its_lock{lock_handlers()};
         auto its_sync_handler = std::make_shared<sync_handler>([handler, _services]() { handler(_services); });
         its_sync_handler->handler_type_ = handler_type_e::OFFERED_SERVICES_INFO;
-        handlers_.push_back(its_sync_handler);
-        dispatcher_condition_.notify_one();
+        push_handler(std::move(its_sync_handler));
+        notify_dispatcher();
     }
 }
 
@@ -2431,11 +2622,11 @@ void application_impl::watchdog_cbk(boost::system::error_code const& _error) {
         }
 
         if (handler) {
-            std::scoped_lock its_lock{handlers_mutex_};
+            auto its_lock{lock_handlers()};
             auto its_sync_handler = std::make_shared<sync_handler>([handler]() { handler(); });
             its_sync_handler->handler_type_ = handler_type_e::WATCHDOG;
-            handlers_.push_back(its_sync_handler);
-            dispatcher_condition_.notify_one();
+            push_handler(std::move(its_sync_handler));
+            notify_dispatcher();
         }
     }
 }
@@ -2780,10 +2971,10 @@ void application_impl::register_message_handler_ext(service_t _service, instance
         members_[key].clear();
         [[gnu::fallthrough]];
     case handler_registration_type_e::HRT_APPEND:
-        members_[key].push_back(_handler);
+        members_[key].push_back(std::make_shared<message_handler_t>(_handler));
         break;
     case handler_registration_type_e::HRT_PREPEND:
-        members_[key].push_front(_handler);
+        members_[key].push_front(std::make_shared<message_handler_t>(_handler));
         break;
     default:;
     }
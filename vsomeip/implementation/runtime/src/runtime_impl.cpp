@@ -7,7 +7,9 @@
 
 #include "../include/application_impl.hpp"
 #include "../include/runtime_impl.hpp"
+#include "../../message/include/external_payload_impl.hpp"
 #include "../../message/include/message_impl.hpp"
+#include "../../message/include/message_pool.hpp"
 #include "../../message/include/payload_impl.hpp"
 
 namespace vsomeip_v3 {
@@ -49,7 +51,7 @@ std::shared_ptr<application> runtime_impl::create_application(const std::string&
 }
 
 std::shared_ptr<message> runtime_impl::create_message(bool _reliable) const {
-    auto its_message = std::make_shared<message_impl>();
+    auto its_message = message_pool::create_message();
     its_message->set_protocol_version(VSOMEIP_PROTOCOL_VERSION);
     its_message->set_return_code(return_code_e::E_OK);
     its_message->set_reliable(_reliable);
@@ -58,7 +60,7 @@ std::shared_ptr<message> runtime_impl::create_message(bool _reliable) const {
 }
 
 std::shared_ptr<message> runtime_impl::create_request(bool _reliable) const {
-    auto its_request = std::make_shared<message_impl>();
+    auto its_request = message_pool::create_message();
     its_request->set_protocol_version(VSOMEIP_PROTOCOL_VERSION);
     its_request->set_message_type(message_type_e::MT_REQUEST);
     its_request->set_return_code(return_code_e::E_OK);
@@ -68,7 +70,7 @@ std::shared_ptr<message> runtime_impl::create_request(bool _reliable) const {
 }
 
 std::shared_ptr<message> runtime_impl::create_response(const std::shared_ptr<message>& _request) const {
-    auto its_response = std::make_shared<message_impl>();
+    auto its_response = message_pool::create_message();
     its_response->set_service(_request->get_service());
     its_response->set_instance(_request->get_instance());
     its_response->set_method(_request->get_method());
@@ -82,7 +84,7 @@ std::shared_ptr<message> runtime_impl::create_response(const std::shared_ptr<mes
 }
 
 std::shared_ptr<message> runtime_impl::create_notification(bool _reliable) const {
-    auto its_notification = std::make_shared<message_impl>();
+    auto its_notification = message_pool::create_message();
     its_notification->set_protocol_version(VSOMEIP_PROTOCOL_VERSION);
     its_notification->set_message_type(message_type_e::MT_NOTIFICATION);
     its_notification->set_return_code(return_code_e::E_OK);
@@ -92,15 +94,23 @@ std::shared_ptr<message> runtime_impl::create_notification(bool _reliable) const
 }
 
 std::shared_ptr<payload> runtime_impl::create_payload() const {
-    return std::make_shared<payload_impl>();
+    return message_pool::create_payload();
 }
 
 std::shared_ptr<payload> runtime_impl::create_payload(const byte_t* _data, uint32_t _size) const {
-    return std::make_shared<payload_impl>(_data, _size);
+    auto its_payload = message_pool::create_payload();
+    its_payload->set_data(_data, _size);
+    return its_payload;
 }
 
 std::shared_ptr<payload> runtime_impl::create_payload(const std::vector<byte_t>& _data) const {
-    return std::make_shared<payload_impl>(_data);
+    auto its_payload = message_pool::create_payload();
+    its_payload->set_data(_data);
+    return its_payload;
+}
+
+std::shared_ptr<payload> runtime_impl::create_external_payload(const byte_t* _data, uint32_t _size, std::shared_ptr<void> _owner) const {
+    return std::make_shared<external_payload_impl>(_data, _size, std::move(_owner));
 }
 
 std::shared_ptr<application> runtime_impl::get_application(const std::string& _name) const {
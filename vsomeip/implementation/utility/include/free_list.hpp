@@ -0,0 +1,147 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_FREE_LIST_HPP_
+#define VSOMEIP_V3_FREE_LIST_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+// Default for objects whose destructor frees them
+template<class T_>
+struct free_list_drop {
+    void operator()(T_&&) const { }
+};
+
+// Objects for reuse that are typically acquired by one thread (receiving) and released by
+// another (dispatching), without a lock between them.
+//
+// Released objects collect in a list of the releasing thread, shared by all free lists of the
+// same type. Once it holds a batch of objects, the list is handed over as a whole through one
+// atomic pointer. A thread whose own list is empty takes the handed over batch and returns its
+// own, emptied list through a second atomic pointer, which the next hand over refills. So the
+// lists keep their capacity and, once warm, neither side allocates. A batch that was not taken
+// yet is dropped when the next one arrives, so the memory held is bounded by two batches per
+// thread plus two per free list.
+//
+// Objects that are not kept are passed to Dispose_: those of a dropped batch, those released
+// with a batch size of 0 and those left in the list of a thread that ends.
+template<class T_, class Dispose_ = free_list_drop<T_>>
+class free_list {
+public:
+    free_list() : full_{nullptr}, empty_{nullptr} { }
+    ~free_list() {
+        batch_t* its_batch = full_.load();
+        if (its_batch) {
+            dispose(*its_batch);
+            delete its_batch;
+        }
+        delete empty_.load();
+    }
+
+    free_list(const free_list&) = delete;
+    free_list& operator=(const free_list&) = delete;
+
+    // Returns a released object or a default constructed one if there is none.
+    T_ acquire() {
+        batch_t* its_local = local();
+        if (its_local == nullptr) {
+            return T_{};
+        }
+        if (its_local->empty()) {
+            batch_t* its_batch = full_.exchange(nullptr, std::memory_order_acq_rel);
+            if (its_batch) {
+                its_local->swap(*its_batch);
+                recycle(its_batch);
+            }
+        }
+        if (its_local->empty()) {
+            return T_{};
+        }
+        T_ its_object = std::move(its_local->back());
+        its_local->pop_back();
+        return its_object;
+    }
+
+    // Keeps _object, the list of the thread is handed over once it holds _batch objects.
+    void release(T_&& _object, std::size_t _batch) {
+        batch_t* its_local = _batch != 0 ? local() : nullptr;
+        if (its_local == nullptr) {
+            Dispose_{}(std::move(_object));
+            return;
+        }
+        its_local->reserve(_batch);
+        its_local->push_back(std::move(_object));
+        if (its_local->size() >= _batch) {
+            batch_t* its_batch = empty_.exchange(nullptr, std::memory_order_acq_rel);
+            if (!its_batch) {
+                its_batch = new batch_t;
+            }
+            its_batch->swap(*its_local);
+            its_local->reserve(_batch);
+
+            its_batch = full_.exchange(its_batch, std::memory_order_acq_rel);
+            if (its_batch) {
+                dispose(*its_batch);
+                recycle(its_batch);
+            }
+        }
+    }
+
+private:
+    using batch_t = std::vector<T_>;
+
+    static void dispose(batch_t& _batch) {
+        for (auto& its_object : _batch) {
+            Dispose_{}(std::move(its_object));
+        }
+        _batch.clear();
+    }
+
+    // Keeps an emptied batch for the next hand over
+    void recycle(batch_t* _batch) { delete empty_.exchange(_batch, std::memory_order_acq_rel); }
+
+    // Drops the list of the thread when it ends, the free lists may be gone already
+    struct local_owner {
+        ~local_owner() {
+            // Later acquires and releases of this thread bypass the list
+            batch_t* its_local = local_;
+            local_ = nullptr;
+            is_closed_ = true;
+            if (its_local) {
+                dispose(*its_local);
+                delete its_local;
+            }
+        }
+    };
+
+    // Plain pointer, so that the fast path needs no initialization guard
+    static batch_t* local() {
+        if (local_ == nullptr && !is_closed_) {
+            thread_local local_owner its_owner;
+            local_ = new batch_t;
+        }
+        return local_;
+    }
+
+    static thread_local batch_t* local_;
+    static thread_local bool is_closed_;
+
+    std::atomic<batch_t*> full_;
+    std::atomic<batch_t*> empty_;
+};
+
+template<class T_, class Dispose_>
+thread_local typename free_list<T_, Dispose_>::batch_t* free_list<T_, Dispose_>::local_{nullptr};
+
+template<class T_, class Dispose_>
+thread_local bool free_list<T_, Dispose_>::is_closed_{false};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_FREE_LIST_HPP_
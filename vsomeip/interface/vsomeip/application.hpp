@@ -1103,6 +1103,51 @@ public:
      * \return policy_manager shared pointer
      */
     virtual std::shared_ptr<policy_manager> get_policy_manager() const = 0;
+
+    /**
+     *
+     * \brief Offers several SOME/IP events or fields of a service instance.
+     *
+     * Has the same effect as calling offer_event for each of the events,
+     * but a non-routing application registers them at the routing component
+     * with as few commands as possible. This speeds up offering services
+     * with many events. Epsilon change functions are not supported.
+     * The default implementation calls offer_event for each event.
+     *
+     * \param _service Service identifier of the interface containing the
+     * events.
+     * \param _instance Instance identifier of the interface containing the
+     * events.
+     * \param _events Events with their eventgroups, type, reliability and
+     * update settings.
+     */
+    virtual void offer_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events) {
+        for (const auto& its_event : _events) {
+            offer_event(_service, _instance, its_event.event_, its_event.eventgroups_, its_event.type_, its_event.cycle_,
+                        its_event.change_resets_cycle_, its_event.update_on_change_, nullptr, its_event.reliability_);
+        }
+    }
+
+    /**
+     *
+     * \brief Registers the application as user of several events or fields.
+     *
+     * Has the same effect as calling request_event for each of the events,
+     * but a non-routing application registers them at the routing component
+     * with as few commands as possible. The default implementation calls
+     * request_event for each event.
+     *
+     * \param _service Service identifier of the interface that contains the
+     * events.
+     * \param _instance Instance identifier of the interface that contains the
+     * events.
+     * \param _events Events with their eventgroups, type and reliability.
+     */
+    virtual void request_events(service_t _service, instance_t _instance, const std::vector<event_registration_t>& _events) {
+        for (const auto& its_event : _events) {
+            request_event(_service, _instance, its_event.event_, its_event.eventgroups_, its_event.type_, its_event.reliability_);
+        }
+    }
 };
 
 /** @} */
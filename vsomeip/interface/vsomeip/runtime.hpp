@@ -216,6 +216,34 @@ public:
      *
      */
     virtual std::shared_ptr<application> create_application(const std::string& _name, const std::string& _path) = 0;
+
+    /**
+     *
+     * \brief Creates a payload object that references the given data
+     * without copying it.
+     *
+     * The payload refers to the given memory until its content is
+     * modified, in which case the data is copied into an internal buffer
+     * first. The referenced memory is never written.
+     *
+     * If an owner is given, the payload keeps it alive as long as the
+     * memory is referenced (adopt). Without an owner, the caller must
+     * guarantee that the memory outlives all uses of the payload, e.g.
+     * a synchronous @ref application::send or @ref application::notify
+     * call (borrow).
+     *
+     * The default implementation copies the data like @ref create_payload.
+     *
+     * \param _data Bytes to be referenced by the payload object.
+     * \param _size Number of bytes to be referenced by the payload object.
+     * \param _owner Optional handle keeping the referenced memory alive.
+     *
+     */
+    virtual std::shared_ptr<payload> create_external_payload(const byte_t* _data, uint32_t _size,
+                                                             std::shared_ptr<void> _owner = nullptr) const {
+        (void)_owner;
+        return create_payload(_data, _size);
+    }
 };
 
 /** @} */
@@ -8,6 +8,10 @@
 
 #include <chrono>
 #include <map>
+#include <set>
+
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
 
 namespace vsomeip_v3 {
 
@@ -54,6 +58,25 @@ struct debounce_filter_t {
     bool send_current_value_after_;
 };
 
+// Event or field of a bulk registration (application::offer_events and
+// application::request_events). The cycle and update settings are only
+// used for offered events, they have the same meaning and defaults as the
+// parameters of application::offer_event.
+struct event_registration_t {
+    event_registration_t(event_t _event, const std::set<eventgroup_t>& _eventgroups, event_type_e _type = event_type_e::ET_EVENT,
+                         reliability_type_e _reliability = reliability_type_e::RT_UNKNOWN) :
+        event_(_event), eventgroups_(_eventgroups), type_(_type), reliability_(_reliability), cycle_(std::chrono::milliseconds::zero()),
+        change_resets_cycle_(false), update_on_change_(true) { }
+
+    event_t event_;
+    std::set<eventgroup_t> eventgroups_;
+    event_type_e type_;
+    reliability_type_e reliability_;
+    std::chrono::milliseconds cycle_;
+    bool change_resets_cycle_;
+    bool update_on_change_;
+};
+
 } // namespace vsomeip_v3
 
 #endif // VSOMEIP_V3_STRUCTURED_TYPES_HPP
@@ -0,0 +1,154 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include "../../../implementation/message/include/deserializer.hpp"
+#include "../../../implementation/message/include/message_impl.hpp"
+#include "../../../implementation/message/include/message_pool.hpp"
+
+// Counts the heap allocations of the whole benchmark binary. GCC does not see
+// that the replaced operators pair malloc and free.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+}
+
+void* operator new(std::size_t _size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* its_memory = std::malloc(_size ? _size : 1)) {
+        return its_memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* _memory) noexcept {
+    std::free(_memory);
+}
+
+void operator delete(void* _memory, std::size_t) noexcept {
+    std::free(_memory);
+}
+
+namespace {
+const std::size_t pool_capacity = 64;
+const std::size_t payload_size = 64;
+
+// Notification 1234.5678.8001 with a payload of payload_size bytes
+std::vector<vsomeip_v3::byte_t> make_notification_data() {
+    std::vector<vsomeip_v3::byte_t> its_data{0x12, 0x34, 0x80, 0x01, 0x00, 0x00, 0x00, static_cast<vsomeip_v3::byte_t>(8 + payload_size),
+                                             0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00};
+    its_data.resize(its_data.size() + payload_size, 0x55);
+    return its_data;
+}
+
+void count_allocations(benchmark::State& state, std::size_t _start) {
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations - _start), benchmark::Counter::kAvgIterations);
+}
+}
+
+// Send path: a notification with a new payload, as an application creates it
+static void BM_message_pool_create_notification(benchmark::State& state) {
+    vsomeip_v3::message_pool::set_capacity(static_cast<std::size_t>(state.range(0)));
+    auto its_runtime = vsomeip_v3::runtime::get();
+    const std::vector<vsomeip_v3::byte_t> its_data(payload_size, 0x55);
+
+    const std::size_t its_start{allocations};
+    for (auto _ : state) {
+        auto its_notification = its_runtime->create_notification();
+        its_notification->set_payload(its_runtime->create_payload(its_data));
+        benchmark::DoNotOptimize(its_notification);
+    }
+    count_allocations(state, its_start);
+    vsomeip_v3::message_pool::set_capacity(0);
+}
+
+// Receive path: deserializing a notification from a receive buffer
+static void BM_message_pool_deserialize(benchmark::State& state) {
+    vsomeip_v3::message_pool::set_capacity(static_cast<std::size_t>(state.range(0)));
+    auto its_data = make_notification_data();
+    vsomeip_v3::deserializer its_deserializer(0);
+
+    const std::size_t its_start{allocations};
+    for (auto _ : state) {
+        its_deserializer.set_data(its_data.data(), its_data.size());
+        auto its_message = its_deserializer.deserialize_message();
+        benchmark::DoNotOptimize(its_message);
+        its_deserializer.reset();
+    }
+    count_allocations(state, its_start);
+    vsomeip_v3::message_pool::set_capacity(0);
+}
+
+// Receive path with handover: messages are deserialized here and dropped by
+// another thread, as a dispatcher does
+static void BM_message_pool_deserialize_handover(benchmark::State& state) {
+    vsomeip_v3::message_pool::set_capacity(static_cast<std::size_t>(state.range(0)));
+    auto its_data = make_notification_data();
+    vsomeip_v3::deserializer its_deserializer(0);
+
+    const std::size_t batch_size = 16;
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    std::vector<std::shared_ptr<vsomeip_v3::message_impl>> its_batch, its_next;
+    its_batch.reserve(batch_size);
+    its_next.reserve(batch_size);
+    bool is_full{false}, is_done{false};
+
+    std::thread its_dispatcher([&] {
+        std::unique_lock<std::mutex> its_lock{its_mutex};
+        while (true) {
+            its_condition.wait(its_lock, [&] { return is_full || is_done; });
+            if (is_done) {
+                return;
+            }
+            its_next.clear();
+            is_full = false;
+            its_condition.notify_one();
+        }
+    });
+
+    const std::size_t its_start{allocations};
+    for (auto _ : state) {
+        its_deserializer.set_data(its_data.data(), its_data.size());
+        its_batch.push_back(its_deserializer.deserialize_message());
+        its_deserializer.reset();
+        if (its_batch.size() == batch_size) {
+            std::unique_lock<std::mutex> its_lock{its_mutex};
+            its_condition.wait(its_lock, [&] { return !is_full; });
+            std::swap(its_batch, its_next);
+            is_full = true;
+            its_condition.notify_one();
+        }
+    }
+    count_allocations(state, its_start);
+
+    {
+        std::unique_lock<std::mutex> its_lock{its_mutex};
+        its_condition.wait(its_lock, [&] { return !is_full; });
+        is_done = true;
+        its_condition.notify_one();
+    }
+    its_dispatcher.join();
+    its_batch.clear();
+    vsomeip_v3::message_pool::set_capacity(0);
+}
+
+BENCHMARK(BM_message_pool_create_notification)->Arg(0)->Arg(pool_capacity);
+BENCHMARK(BM_message_pool_deserialize)->Arg(0)->Arg(pool_capacity);
+BENCHMARK(BM_message_pool_deserialize_handover)->Arg(0)->Arg(pool_capacity);
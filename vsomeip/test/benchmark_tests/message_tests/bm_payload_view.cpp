@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <vsomeip/defines.hpp>
+#include <vsomeip/payload.hpp>
+
+#include "../../../implementation/message/include/deserializer.hpp"
+#include "../../../implementation/message/include/message_impl.hpp"
+#include "../../../implementation/message/include/receive_buffer_lender.hpp"
+
+namespace {
+// Receive buffer holding a notification with a payload of _size bytes
+std::vector<vsomeip_v3::byte_t> make_receive_buffer(std::size_t _size) {
+    const std::uint32_t its_length = static_cast<std::uint32_t>(8 + _size);
+    std::vector<vsomeip_v3::byte_t> its_buffer{0x12,
+                                               0x34,
+                                               0x80,
+                                               0x01,
+                                               static_cast<vsomeip_v3::byte_t>(its_length >> 24),
+                                               static_cast<vsomeip_v3::byte_t>(its_length >> 16),
+                                               static_cast<vsomeip_v3::byte_t>(its_length >> 8),
+                                               static_cast<vsomeip_v3::byte_t>(its_length),
+                                               0x00,
+                                               0x00,
+                                               0x00,
+                                               0x01,
+                                               0x01,
+                                               0x01,
+                                               0x02,
+                                               0x00};
+    its_buffer.resize(its_buffer.size() + _size, 0x55);
+    return its_buffer;
+}
+}
+
+// Receive path of an endpoint: the message is deserialized from the receive buffer and still
+// queued for dispatching when the endpoint receives the next data. Receiving is reduced to
+// writing the header.
+static void BM_payload_copy(benchmark::State& state) {
+    auto its_buffer = make_receive_buffer(static_cast<std::size_t>(state.range(0)));
+    const std::vector<vsomeip_v3::byte_t> its_header(its_buffer.begin(), its_buffer.begin() + VSOMEIP_FULL_HEADER_SIZE);
+    vsomeip_v3::deserializer its_deserializer(0);
+
+    for (auto _ : state) {
+        std::copy(its_header.begin(), its_header.end(), its_buffer.begin());
+        auto its_message = its_deserializer.deserialize_message(its_buffer.data(), its_buffer.size());
+        its_deserializer.reset();
+        benchmark::DoNotOptimize(its_message->get_payload()->get_length());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * its_buffer.size()));
+}
+
+static void BM_payload_view(benchmark::State& state) {
+    auto its_buffer = make_receive_buffer(static_cast<std::size_t>(state.range(0)));
+    vsomeip_v3::deserializer its_deserializer(0);
+    const std::vector<vsomeip_v3::byte_t> its_header(its_buffer.begin(), its_buffer.begin() + VSOMEIP_FULL_HEADER_SIZE);
+    vsomeip_v3::receive_buffer_lender its_lender;
+
+    for (auto _ : state) {
+        std::copy(its_header.begin(), its_header.end(), its_buffer.begin());
+        vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+        auto its_message = its_deserializer.deserialize_message(its_buffer.data(), its_buffer.size());
+        its_deserializer.reset();
+        its_lending.reclaim(0, 0);
+        benchmark::DoNotOptimize(its_message->get_payload()->get_length());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * its_buffer.size()));
+}
+
+BENCHMARK(BM_payload_copy)->Arg(1024)->Arg(16384)->Arg(65000);
+BENCHMARK(BM_payload_view)->Arg(1024)->Arg(16384)->Arg(65000);
@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "tunnel_publisher_pool.hpp"
+
+// Messages/s through the TunnelToRust publishing path versus the number of concurrently
+// publishing (dispatcher) threads. Argument 0 is the number of per-thread publishers the pool
+// may create: 0 reproduces the former single publisher behind one mutex.
+
+namespace {
+constexpr int max_threads = 16;
+constexpr uint64_t payload_size = 64;
+
+struct fixture {
+    explicit fixture(iox2::Node<iox2::ServiceType::Ipc>&& _node) : node(std::move(_node)) { }
+
+    iox2::Node<iox2::ServiceType::Ipc> node;
+    std::unique_ptr<TunnelPublisherPool> pool;
+    std::atomic_bool is_running{true};
+    std::thread drain;
+};
+
+std::unique_ptr<fixture> the_fixture;
+
+void setup(const benchmark::State& state) {
+    const auto its_max_thread_ports = static_cast<size_t>(state.range(0));
+    const std::string its_name{"TunnelBenchmark" + std::to_string(getpid()) + "_" + std::to_string(state.threads()) + "_"
+                               + std::to_string(its_max_thread_ports)};
+
+    the_fixture.reset(new fixture{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")});
+
+    auto& its_node = the_fixture->node;
+    the_fixture->pool.reset(
+            new TunnelPublisherPool{its_node.service_builder(iox2::ServiceName::create(its_name.c_str()).expect("valid service name"))
+                                            .publish_subscribe<SomeipTunnelPayload>()
+                                            .user_header<SomeipTunnelHeader>()
+                                            .subscriber_max_buffer_size(256)
+                                            .max_publishers(max_threads + 1)
+                                            .create()
+                                            .expect("successful service creation"),
+                                    its_node.service_builder(iox2::ServiceName::create(its_name.c_str()).expect("valid service name"))
+                                            .event()
+                                            .max_notifiers(max_threads + 1)
+                                            .create()
+                                            .expect("successful service creation"),
+                                    its_max_thread_ports});
+
+    // Gateway stand-in: drains the subscriber so publishers never run into a full buffer
+    auto its_subscriber = its_node.service_builder(iox2::ServiceName::create(its_name.c_str()).expect("valid service name"))
+                                  .publish_subscribe<SomeipTunnelPayload>()
+                                  .user_header<SomeipTunnelHeader>()
+                                  .open()
+                                  .expect("successful service opening")
+                                  .subscriber_builder()
+                                  .create()
+                                  .expect("successful subscriber creation");
+    the_fixture->drain = std::thread{[subscriber = std::move(its_subscriber)]() mutable {
+        while (the_fixture->is_running) {
+            auto its_sample = subscriber.receive();
+            while (its_sample.has_value() && its_sample->has_value()) {
+                its_sample = subscriber.receive();
+            }
+            std::this_thread::yield();
+        }
+    }};
+}
+
+void teardown(const benchmark::State&) {
+    the_fixture->is_running = false;
+    the_fixture->drain.join();
+    the_fixture.reset();
+}
+}
+
+static void BM_tunnel_publish(benchmark::State& state) {
+    uint8_t its_data[payload_size];
+    std::memset(its_data, 0xA5, sizeof(its_data));
+
+    for (auto _ : state) {
+        the_fixture->pool->withPublisher([&](TunnelPublisher& publisher, const TunnelPublisherPool::Notifier& notifier) {
+            auto its_sample = publisher.loan_slice_uninit(payload_size).expect("should have sample");
+            its_sample.user_header_mut() = SomeipTunnelHeader{};
+            its_sample.user_header_mut().type = TunnelMsgType::MESSAGE;
+            std::memcpy(its_sample.payload_mut().data(), its_data, payload_size);
+            ::iox2::send(iox2::assume_init(std::move(its_sample))).expect("Sending sample shall work");
+            notifyGateway(notifier);
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_tunnel_publish)
+        ->ArgName("thread_publishers")
+        ->Arg(0)
+        ->Arg(max_threads)
+        ->ThreadRange(1, max_threads)
+        ->UseRealTime()
+        ->Setup(setup)
+        ->Teardown(teardown);
@@ -0,0 +1,396 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+#include <common/vsomeip_app_utilities.hpp>
+
+#include "iceoryx2_bridge.hpp"
+#include "tunnel_publisher_pool.hpp"
+#include "tunnel_stats.hpp"
+
+// End-to-end benchmarks of the tunnel: SOME/IP clients and subscribers talk to a service that a
+// gateway stand-in offers through the tunnel. The stand-in speaks the TunnelToRust/TunnelFromRust
+// protocol like the Rust gateway, but only echoes requests and publishes events, so the numbers
+// cover vsomeip routing, the tunnel and iceoryx2 without any gateway logic.
+//
+// Routing manager, tunnel, stand-in and clients run in this process, cpu_ns_per_msg is the CPU
+// time of all of them per message. The benchmark uses the lane names of a default tunnel and
+// must not run next to one.
+
+namespace {
+constexpr vsomeip::service_t service_id = 0x6001;
+constexpr vsomeip::instance_t instance_id = 0x0001;
+constexpr vsomeip::method_t method_id = 0x0001;
+constexpr vsomeip::event_t event_id = 0x8001;
+constexpr vsomeip::eventgroup_t eventgroup_id = 0x0001;
+
+constexpr int max_subscribers = 8;
+constexpr int min_payload = 8;
+constexpr int max_payload = 64 * 1024;
+// Events in flight per subscriber, below the default lane buffer size of 20 so that the
+// TunnelFromRust subscriber of the tunnel never overflows
+constexpr uint64_t event_window = 16;
+constexpr std::chrono::seconds wait_timeout{5};
+
+uint64_t process_cpu_ns() {
+    timespec its_time{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &its_time);
+    return static_cast<uint64_t>(its_time.tv_sec) * 1000000000u + static_cast<uint64_t>(its_time.tv_nsec);
+}
+
+using node = iox2::Node<iox2::ServiceType::Ipc>;
+
+// The tunnel creates the services of its lanes in init(), the gateway only opens them
+auto open_service(node& _node, const std::string& _name) {
+    return _node.service_builder(iox2::ServiceName::create(_name.c_str()).expect("valid service name"))
+            .publish_subscribe<SomeipTunnelPayload>()
+            .user_header<SomeipTunnelHeader>()
+            .open()
+            .expect("successful service opening");
+}
+
+auto open_event(node& _node, const std::string& _name) {
+    return _node.service_builder(iox2::ServiceName::create(_name.c_str()).expect("valid service name"))
+            .event()
+            .open()
+            .expect("successful service opening");
+}
+
+// Gateway side of lane 0: answers every request with its own payload and publishes events on
+// demand.
+class gateway_stand_in {
+public:
+    gateway_stand_in() :
+        node_{iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")},
+        lane_{TunnelConfig{}.lane(0)},
+        to_tunnel_{open_service(node_, lane_.from_gateway), open_event(node_, lane_.from_gateway), 0,
+                   iox2::UnableToDeliverStrategy::DiscardSample, max_payload},
+        from_tunnel_{open_service(node_, lane_.to_gateway).subscriber_builder().create().expect("successful subscriber creation")},
+        listener_{open_event(node_, lane_.to_gateway).listener_builder().create().expect("successful listener creation")},
+        is_running_{true} {
+        run_thread_ = std::thread{[this] { run(); }};
+    }
+
+    ~gateway_stand_in() {
+        is_running_ = false;
+        run_thread_.join();
+    }
+
+    void offer() {
+        std::vector<uint8_t> its_records;
+        appendEventRecord(its_records, event_id, EventType::Event, &eventgroup_id, 1);
+
+        SomeipTunnelHeader its_header{};
+        its_header.type = TunnelMsgType::OFFER_SERVICE;
+        its_header.service_id = service_id;
+        its_header.instance_id = instance_id;
+        to_tunnel_.publish(its_header, its_records.data(), its_records.size());
+    }
+
+    void notify(const uint8_t* _data, size_t _size) {
+        SomeipTunnelHeader its_header{};
+        its_header.type = TunnelMsgType::EVENT;
+        its_header.service_id = service_id;
+        its_header.instance_id = instance_id;
+        its_header.method_id = event_id;
+        its_header.message_type = static_cast<uint8_t>(vsomeip::message_type_e::MT_NOTIFICATION);
+        to_tunnel_.publish(its_header, _data, _size);
+    }
+
+private:
+    void run() {
+        const auto its_cycle = iox::units::Duration::fromMilliseconds(10);
+        while (is_running_) {
+            if (listener_.timed_wait_all([](iox2::EventId) {}, its_cycle).has_error()) {
+                break;
+            }
+
+            auto its_sample = from_tunnel_.receive();
+            while (its_sample.has_value() && its_sample->has_value()) {
+                const auto& its_header = its_sample->value().user_header();
+                if (its_header.type == TunnelMsgType::MESSAGE
+                    && its_header.message_type == static_cast<uint8_t>(vsomeip::message_type_e::MT_REQUEST)) {
+                    const auto its_payload = its_sample->value().payload();
+
+                    SomeipTunnelHeader its_response{its_header};
+                    its_response.message_type = static_cast<uint8_t>(vsomeip::message_type_e::MT_RESPONSE);
+                    to_tunnel_.publish(its_response, its_payload.data(), its_payload.number_of_elements());
+                }
+                its_sample = from_tunnel_.receive();
+            }
+        }
+    }
+
+    node node_;
+    const TunnelLaneConfig lane_;
+    TunnelPublisherPool to_tunnel_;
+    TunnelSubscriber from_tunnel_;
+    iox2::Listener<iox2::ServiceType::Ipc> listener_;
+    std::atomic_bool is_running_;
+    std::thread run_thread_;
+};
+
+// SOME/IP side: calls the method of the benchmark service or subscribes to its eventgroup.
+class someip_client : public vsomeip_utilities::base_vsip_app {
+public:
+    explicit someip_client(const std::string& _name) : base_vsip_app(_name.c_str(), "TBCL"), is_available_(false), responses_(0) {
+        _app->register_availability_handler(service_id, instance_id,
+                                            [this](vsomeip::service_t, vsomeip::instance_t, bool _is_available) {
+                                                std::lock_guard<std::mutex> its_lock(mutex_);
+                                                is_available_ = _is_available;
+                                                condition_.notify_all();
+                                            });
+        _app->register_message_handler(service_id, instance_id, vsomeip::ANY_METHOD,
+                                       [this](const std::shared_ptr<vsomeip::message>& _message) { on_message(_message); });
+        _app->request_event(service_id, instance_id, event_id, {eventgroup_id}, vsomeip::event_type_e::ET_EVENT);
+        _app->request_service(service_id, instance_id);
+    }
+
+    bool wait_available() {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, wait_timeout, [this] { return is_available_; });
+    }
+
+    // Sends the request and waits for its response.
+    bool call(const std::shared_ptr<vsomeip::message>& _request) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        const auto its_expected = responses_ + 1;
+        _app->send(_request);
+        return condition_.wait_for(its_lock, wait_timeout, [this, its_expected] { return responses_ >= its_expected; });
+    }
+
+    void subscribe() { _app->subscribe(service_id, instance_id, eventgroup_id); }
+    void unsubscribe() { _app->unsubscribe(service_id, instance_id, eventgroup_id); }
+
+    uint64_t notifications() const { return notifications_.load(std::memory_order_relaxed); }
+
+private:
+    void on_message(const std::shared_ptr<vsomeip::message>& _message) {
+        if (_message->get_message_type() == vsomeip::message_type_e::MT_NOTIFICATION) {
+            notifications_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        responses_++;
+        condition_.notify_all();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_available_;
+    uint64_t responses_;
+    std::atomic<uint64_t> notifications_{0};
+};
+
+// Shared by all benchmarks of a run and never destroyed, vsomeip applications cannot be
+// recreated within a process.
+class environment {
+public:
+    static environment& get() {
+        static environment* its_environment = new environment{};
+        return *its_environment;
+    }
+
+    bool is_ready() const { return is_ready_; }
+    gateway_stand_in& gateway() { return *gateway_; }
+    someip_client& client() { return *client_; }
+    someip_client& subscriber(size_t _index) { return *subscribers_[_index]; }
+
+private:
+    environment() : is_ready_(false) {
+        // An existing setting wins, e.g. to raise the log level
+        setenv("VSOMEIP_CONFIGURATION", TUNNEL_BENCHMARK_CONFIGURATION, 0);
+
+        auto its_runtime = vsomeip::runtime::get();
+        routing_ = its_runtime->create_application("TunnelBenchmarkRouting");
+        if (!routing_->init()) {
+            return;
+        }
+        routing_thread_ = std::thread{[this] { routing_->start(); }};
+
+        tunnel_.reset(new SomeipTunnel(its_runtime));
+        tunnel_->init();
+        tunnel_thread_ = std::thread{[this] { tunnel_->start(); }};
+
+        gateway_.reset(new gateway_stand_in{});
+        gateway_->offer();
+
+        client_.reset(new someip_client{"TunnelBenchmarkClient"});
+        for (int i = 0; i < max_subscribers; i++) {
+            subscribers_.emplace_back(new someip_client{"TunnelBenchmarkSubscriber" + std::to_string(i)});
+        }
+
+        is_ready_ = client_->wait_available();
+        for (auto& its_subscriber : subscribers_) {
+            is_ready_ = is_ready_ && its_subscriber->wait_available();
+        }
+    }
+
+    bool is_ready_;
+    std::shared_ptr<vsomeip::application> routing_;
+    std::thread routing_thread_;
+    std::unique_ptr<SomeipTunnel> tunnel_;
+    std::thread tunnel_thread_;
+    std::unique_ptr<gateway_stand_in> gateway_;
+    std::unique_ptr<someip_client> client_;
+    std::vector<std::unique_ptr<someip_client>> subscribers_;
+};
+
+// Round trip of a request from a SOME/IP client through the tunnel to the gateway and back.
+void BM_tunnel_request_rtt(benchmark::State& state) {
+    auto& its_environment = environment::get();
+    if (!its_environment.is_ready()) {
+        state.SkipWithError("tunnel service not available");
+        return;
+    }
+
+    const auto its_size = static_cast<size_t>(state.range(0));
+    auto its_request = vsomeip_utilities::create_standard_vsip_request(service_id, instance_id, method_id, 0,
+                                                                       vsomeip::message_type_e::MT_REQUEST);
+    its_request->set_payload(vsomeip::runtime::get()->create_payload(std::vector<vsomeip::byte_t>(its_size, 0xA5)));
+
+    LatencyHistogram its_rtt;
+    const auto its_cpu_start = process_cpu_ns();
+    for (auto _ : state) {
+        const auto its_start = std::chrono::steady_clock::now();
+        if (!its_environment.client().call(its_request)) {
+            state.SkipWithError("no response from the gateway stand-in");
+            break;
+        }
+        its_rtt.record(std::chrono::steady_clock::now() - its_start);
+    }
+    const auto its_cpu = process_cpu_ns() - its_cpu_start;
+
+    const auto its_iterations = static_cast<int64_t>(state.iterations());
+    const auto its_latency = its_rtt.summarize();
+    state.SetItemsProcessed(its_iterations);
+    state.SetBytesProcessed(2 * its_iterations * static_cast<int64_t>(its_size));
+    state.counters["p50_us"] = static_cast<double>(its_latency.p50_ns) / 1000.0;
+    state.counters["p99_us"] = static_cast<double>(its_latency.p99_ns) / 1000.0;
+    state.counters["max_us"] = static_cast<double>(its_latency.max_ns) / 1000.0;
+    state.counters["cpu_ns_per_msg"] = its_iterations > 0 ? static_cast<double>(its_cpu) / static_cast<double>(its_iterations) : 0.0;
+}
+
+// Subscribes the first range(1) subscribers, the others unsubscribe.
+void setup_fanout(const benchmark::State& state) {
+    auto& its_environment = environment::get();
+    if (!its_environment.is_ready()) {
+        return;
+    }
+
+    const auto its_subscribers = static_cast<int>(state.range(1));
+    std::vector<uint64_t> its_start;
+    for (int i = 0; i < max_subscribers; i++) {
+        if (i < its_subscribers) {
+            its_environment.subscriber(i).subscribe();
+        } else {
+            its_environment.subscriber(i).unsubscribe();
+        }
+        its_start.push_back(its_environment.subscriber(i).notifications());
+    }
+
+    // Events only reach a subscriber once its subscription is acknowledged
+    const uint8_t its_data[min_payload]{};
+    const auto its_deadline = std::chrono::steady_clock::now() + wait_timeout;
+    bool is_subscribed = false;
+    while (!is_subscribed && std::chrono::steady_clock::now() < its_deadline) {
+        its_environment.gateway().notify(its_data, sizeof(its_data));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        is_subscribed = true;
+        for (int i = 0; i < its_subscribers; i++) {
+            is_subscribed = is_subscribed && its_environment.subscriber(i).notifications() > its_start[i];
+        }
+    }
+    // Lets the stragglers of the warm-up arrive before the counting starts
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
+
+// Events published by the gateway and delivered to range(1) SOME/IP subscribers.
+void BM_tunnel_event_fanout(benchmark::State& state) {
+    auto& its_environment = environment::get();
+    if (!its_environment.is_ready()) {
+        state.SkipWithError("tunnel service not available");
+        return;
+    }
+
+    const auto its_size = static_cast<size_t>(state.range(0));
+    const auto its_subscribers = static_cast<size_t>(state.range(1));
+    std::vector<uint8_t> its_data(its_size, 0xA5);
+
+    std::vector<uint64_t> its_start;
+    for (size_t i = 0; i < its_subscribers; i++) {
+        its_start.push_back(its_environment.subscriber(i).notifications());
+    }
+    const auto received = [&](bool _is_total) {
+        uint64_t its_result = _is_total ? 0 : UINT64_MAX;
+        for (size_t i = 0; i < its_subscribers; i++) {
+            const auto its_count = its_environment.subscriber(i).notifications() - its_start[i];
+            its_result = _is_total ? its_result + its_count : std::min(its_result, its_count);
+        }
+        return its_result;
+    };
+    // Waits until the slowest subscriber has received all but in_flight of the sent events
+    const auto wait_for = [&](uint64_t _sent, uint64_t _in_flight) {
+        const auto its_deadline = std::chrono::steady_clock::now() + wait_timeout;
+        while (_sent - std::min(_sent, received(false)) > _in_flight) {
+            if (std::chrono::steady_clock::now() > its_deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    };
+
+    uint64_t its_sent = 0;
+    bool is_stalled = false;
+    const auto its_cpu_start = process_cpu_ns();
+    for (auto _ : state) {
+        if (!wait_for(its_sent, event_window - 1)) {
+            is_stalled = true;
+            break;
+        }
+        // Sequence number in the payload, like a real producer changing its value
+        std::memcpy(its_data.data(), &its_sent, std::min(its_size, sizeof(its_sent)));
+        its_environment.gateway().notify(its_data.data(), its_size);
+        its_sent++;
+    }
+    is_stalled = is_stalled || !wait_for(its_sent, 0);
+    const auto its_cpu = process_cpu_ns() - its_cpu_start;
+
+    if (is_stalled) {
+        state.SkipWithError("events lost on the way to the subscribers");
+    }
+    const auto its_delivered = received(true);
+    state.SetItemsProcessed(static_cast<int64_t>(its_delivered));
+    state.SetBytesProcessed(static_cast<int64_t>(its_delivered * its_size));
+    state.counters["lost"] = static_cast<double>(its_sent * its_subscribers) - static_cast<double>(its_delivered);
+    state.counters["cpu_ns_per_msg"] = its_delivered > 0 ? static_cast<double>(its_cpu) / static_cast<double>(its_delivered) : 0.0;
+}
+}
+
+BENCHMARK(BM_tunnel_request_rtt)->ArgName("payload")->RangeMultiplier(8)->Range(min_payload, max_payload)->UseRealTime();
+
+BENCHMARK(BM_tunnel_event_fanout)
+        ->ArgNames({"payload", "subscribers"})
+        ->ArgsProduct({benchmark::CreateRange(min_payload, max_payload, 8), {1, 4, max_subscribers}})
+        ->UseRealTime()
+        ->Setup(setup_fanout);
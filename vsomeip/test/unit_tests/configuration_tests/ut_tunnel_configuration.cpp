@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+
+namespace {
+std::shared_ptr<vsomeip_v3::cfg::configuration_impl> load_configuration(const std::string& _json) {
+    const std::string its_path("/tmp/ut_tunnel_configuration.json");
+    {
+        std::ofstream its_file(its_path);
+        its_file << _json;
+    }
+
+    auto its_config = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path);
+    its_config->load("ut_tunnel_configuration");
+    std::remove(its_path.c_str());
+    return its_config;
+}
+}
+
+TEST(tunnel_configuration_test, defaults_without_section) {
+    auto its_config = load_configuration(R"({ "unicast" : "127.0.0.1" })");
+    auto its_tunnel = its_config->get_tunnel();
+
+    ASSERT_TRUE(its_tunnel);
+    EXPECT_FALSE(its_tunnel->is_configured_);
+    EXPECT_TRUE(its_tunnel->lanes_.empty());
+    EXPECT_TRUE(its_tunnel->topics_.empty());
+    EXPECT_EQ(its_tunnel->max_requests_, VSOMEIP_DEFAULT_TUNNEL_MAX_REQUESTS);
+    EXPECT_EQ(its_tunnel->stats_interval_, VSOMEIP_DEFAULT_TUNNEL_STATS_INTERVAL);
+    EXPECT_EQ(its_tunnel->restart_grace_, VSOMEIP_DEFAULT_TUNNEL_RESTART_GRACE);
+    EXPECT_EQ(its_tunnel->field_cache_slots_, VSOMEIP_DEFAULT_TUNNEL_FIELD_CACHE_SLOTS);
+    EXPECT_EQ(its_tunnel->event_throttle_, VSOMEIP_DEFAULT_TUNNEL_EVENT_THROTTLE);
+    EXPECT_EQ(its_tunnel->max_gateways_, VSOMEIP_DEFAULT_TUNNEL_MAX_GATEWAYS);
+}
+
+TEST(tunnel_configuration_test, section_without_lanes_has_default_lane) {
+    auto its_config = load_configuration(R"({
+        "unicast" : "127.0.0.1",
+        "tunnel" : { "wait_mode" : "hybrid", "spin_time" : "0" }
+    })");
+    auto its_tunnel = its_config->get_tunnel();
+
+    EXPECT_TRUE(its_tunnel->is_configured_);
+    EXPECT_EQ(its_tunnel->wait_mode_, "hybrid");
+    EXPECT_EQ(its_tunnel->spin_time_, 0u);
+    ASSERT_EQ(its_tunnel->lanes_.size(), 1u);
+    EXPECT_EQ(its_tunnel->lanes_[0].buffer_size_, VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE);
+    EXPECT_EQ(its_tunnel->lanes_[0].history_size_, VSOMEIP_DEFAULT_TUNNEL_HISTORY_SIZE);
+    EXPECT_TRUE(its_tunnel->lanes_[0].is_safe_overflow_);
+    EXPECT_TRUE(its_tunnel->lanes_[0].to_gateway_.empty());
+}
+
+TEST(tunnel_configuration_test, lanes_and_classes) {
+    auto its_config = load_configuration(R"({
+        "unicast" : "127.0.0.1",
+        "tunnel" : {
+            "max_thread_publishers" : "4",
+            "request_timeout" : "250",
+            "stats_interval" : "0",
+            "restart_grace" : "2000",
+            "field_cache" : "16",
+            "event_throttle" : "250",
+            "max_gateways" : "3",
+            "batch" : { "max_messages" : "8", "max_bytes" : "4096", "max_delay" : "100" },
+            "lane_hash" : "true",
+            "classes" : { "control" : "0", "event" : "1" },
+            "lanes" : [
+                {
+                    "to_gateway" : "ControlToGateway",
+                    "from_gateway" : "ControlFromGateway",
+                    "subscriber_max_buffer_size" : "64",
+                    "safe_overflow" : "false",
+                    "cpu" : "2"
+                },
+                {
+                    "subscriber_max_buffer_size" : "0",
+                    "history_size" : "0",
+                    "max_publishers" : "3",
+                    "max_subscribers" : "2",
+                    "max_loaned_samples" : "4",
+                    "initial_max_slice_len" : "65536",
+                    "services" : [
+                        { "first" : "0x1000", "last" : "0x10ff" },
+                        { "first" : { "service" : "0x2000", "instance" : "0x1" },
+                          "last" : { "service" : "0x2000", "instance" : "0x2" } },
+                        { "first" : "0x3000", "last" : "0x2000" }
+                    ]
+                }
+            ],
+            "topics" : [
+                { "name" : "Vehicle/Speed", "service" : "0x1234", "instance" : "0x1", "event" : "0x8001" },
+                { "name" : "Vehicle/Doors", "service" : "0x1234", "instance" : "0x1", "eventgroup" : "0x10",
+                  "subscriber_max_buffer_size" : "8", "history_size" : "0" },
+                { "name" : "Ambiguous", "service" : "0x1234", "instance" : "0x1", "event" : "0x8002", "eventgroup" : "0x10" },
+                { "service" : "0x1234", "instance" : "0x1", "event" : "0x8003" }
+            ]
+        }
+    })");
+    auto its_tunnel = its_config->get_tunnel();
+
+    EXPECT_EQ(its_tunnel->max_thread_publishers_, 4u);
+    EXPECT_EQ(its_tunnel->request_timeout_, 250u);
+    EXPECT_EQ(its_tunnel->stats_interval_, 0u);
+    EXPECT_EQ(its_tunnel->restart_grace_, 2000u);
+    EXPECT_EQ(its_tunnel->field_cache_slots_, 16u);
+    EXPECT_EQ(its_tunnel->event_throttle_, 250u);
+    EXPECT_EQ(its_tunnel->max_gateways_, 3u);
+    EXPECT_EQ(its_tunnel->batch_max_messages_, 8u);
+    EXPECT_EQ(its_tunnel->batch_max_bytes_, 4096u);
+    EXPECT_EQ(its_tunnel->batch_max_delay_, 100u);
+    EXPECT_TRUE(its_tunnel->is_lane_hash_);
+    EXPECT_EQ(its_tunnel->control_lane_, 0);
+    EXPECT_EQ(its_tunnel->event_lane_, 1);
+    EXPECT_EQ(its_tunnel->request_lane_, -1);
+
+    ASSERT_EQ(its_tunnel->lanes_.size(), 2u);
+
+    const auto& its_control = its_tunnel->lanes_[0];
+    EXPECT_EQ(its_control.to_gateway_, "ControlToGateway");
+    EXPECT_EQ(its_control.from_gateway_, "ControlFromGateway");
+    EXPECT_EQ(its_control.buffer_size_, 64u);
+    EXPECT_FALSE(its_control.is_safe_overflow_);
+    EXPECT_EQ(its_control.cpu_, 2);
+
+    const auto& its_bulk = its_tunnel->lanes_[1];
+    EXPECT_EQ(its_bulk.buffer_size_, VSOMEIP_DEFAULT_TUNNEL_BUFFER_SIZE); // 0 is invalid
+    EXPECT_EQ(its_bulk.history_size_, 0u);
+    EXPECT_EQ(its_bulk.max_publishers_, 3u);
+    EXPECT_EQ(its_bulk.max_subscribers_, 2u);
+    EXPECT_EQ(its_bulk.max_loaned_samples_, 4u);
+    EXPECT_EQ(its_bulk.initial_max_slice_len_, 65536u);
+    EXPECT_EQ(its_bulk.cpu_, -1);
+
+    ASSERT_EQ(its_bulk.services_.size(), 2u);
+    EXPECT_EQ(its_bulk.services_[0].first_service_, 0x1000);
+    EXPECT_EQ(its_bulk.services_[0].last_service_, 0x10ff);
+    EXPECT_EQ(its_bulk.services_[0].first_instance_, 0x0);
+    EXPECT_EQ(its_bulk.services_[0].last_instance_, 0xffff);
+    EXPECT_EQ(its_bulk.services_[1].first_service_, 0x2000);
+    EXPECT_EQ(its_bulk.services_[1].first_instance_, 0x1);
+    EXPECT_EQ(its_bulk.services_[1].last_instance_, 0x2);
+
+    ASSERT_EQ(its_tunnel->topics_.size(), 2u); // the last two lack a name or a unique target
+    const auto& its_speed = its_tunnel->topics_[0];
+    EXPECT_EQ(its_speed.name_, "Vehicle/Speed");
+    EXPECT_EQ(its_speed.service_, 0x1234);
+    EXPECT_EQ(its_speed.instance_, 0x1);
+    EXPECT_EQ(its_speed.event_, 0x8001);
+    EXPECT_EQ(its_speed.eventgroup_, vsomeip_v3::ANY_EVENTGROUP);
+    EXPECT_EQ(its_speed.buffer_size_, VSOMEIP_DEFAULT_TUNNEL_TOPIC_BUFFER_SIZE);
+    EXPECT_EQ(its_speed.history_size_, VSOMEIP_DEFAULT_TUNNEL_TOPIC_HISTORY_SIZE);
+
+    const auto& its_doors = its_tunnel->topics_[1];
+    EXPECT_EQ(its_doors.event_, vsomeip_v3::ANY_EVENT);
+    EXPECT_EQ(its_doors.eventgroup_, 0x10);
+    EXPECT_EQ(its_doors.buffer_size_, 8u);
+    EXPECT_EQ(its_doors.history_size_, 0u);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+
+#include <vsomeip/runtime.hpp>
+
+#include "../../../implementation/message/include/external_payload_impl.hpp"
+#include "../../../implementation/message/include/payload_impl.hpp"
+#include "../../../implementation/message/include/serializer.hpp"
+
+namespace {
+const std::uint32_t buffer_shrink_threshold = 1;
+const std::array<vsomeip_v3::byte_t, 4> data_array{1, 2, 3, 4};
+}
+
+TEST(external_payload_impl_test, references_without_copy) {
+    vsomeip_v3::external_payload_impl its_payload(data_array.data(), data_array.size(), nullptr);
+    const vsomeip_v3::external_payload_impl& its_const_payload{its_payload};
+
+    // Checks.
+    ASSERT_TRUE(its_payload.is_external());
+    ASSERT_EQ(its_const_payload.get_data(), data_array.data());
+    ASSERT_EQ(its_payload.get_length(), data_array.size());
+}
+
+TEST(external_payload_impl_test, keeps_owner_alive) {
+    auto its_owner = std::make_shared<std::vector<vsomeip_v3::byte_t>>(data_array.begin(), data_array.end());
+    std::weak_ptr<std::vector<vsomeip_v3::byte_t>> its_weak_owner{its_owner};
+
+    auto its_payload = vsomeip_v3::runtime::get()->create_external_payload(its_owner->data(),
+                                                                           static_cast<uint32_t>(its_owner->size()), its_owner);
+    its_owner.reset();
+
+    // Checks.
+    ASSERT_FALSE(its_weak_owner.expired());
+    its_payload.reset();
+    ASSERT_TRUE(its_weak_owner.expired());
+}
+
+TEST(external_payload_impl_test, copy_on_write) {
+    auto its_owner = std::make_shared<std::vector<vsomeip_v3::byte_t>>(data_array.begin(), data_array.end());
+    std::weak_ptr<std::vector<vsomeip_v3::byte_t>> its_weak_owner{its_owner};
+
+    vsomeip_v3::external_payload_impl its_payload(its_owner->data(), static_cast<uint32_t>(its_owner->size()), its_owner);
+    its_owner.reset();
+
+    // Test method.
+    its_payload.get_data()[0] = 0xFF;
+
+    // Checks.
+    ASSERT_FALSE(its_payload.is_external());
+    ASSERT_TRUE(its_weak_owner.expired());
+    ASSERT_EQ(its_payload.get_length(), data_array.size());
+    ASSERT_EQ(its_payload.get_data()[0], 0xFF);
+    ASSERT_EQ(its_payload.get_data()[1], data_array[1]);
+}
+
+TEST(external_payload_impl_test, equalequal_operator) {
+    vsomeip_v3::external_payload_impl its_payload(data_array.data(), data_array.size(), nullptr);
+    vsomeip_v3::payload_impl its_similar_payload(data_array.data(), data_array.size());
+    vsomeip_v3::payload_impl its_different_payload(data_array.data(), data_array.size() - 1);
+
+    // Checks.
+    ASSERT_TRUE(its_payload == its_similar_payload);
+    ASSERT_FALSE(its_payload == its_different_payload);
+    ASSERT_TRUE(its_payload.is_external());
+}
+
+TEST(external_payload_impl_test, serialize) {
+    vsomeip_v3::external_payload_impl its_payload(data_array.data(), data_array.size(), nullptr);
+    vsomeip_v3::serializer its_serializer(buffer_shrink_threshold);
+
+    // Test method.
+    ASSERT_TRUE(its_payload.serialize(&its_serializer));
+
+    // Checks.
+    ASSERT_TRUE(its_payload.is_external());
+    ASSERT_EQ(its_serializer.get_size(), data_array.size());
+    ASSERT_EQ(0, std::memcmp(its_serializer.get_data(), data_array.data(), data_array.size()));
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <vsomeip/payload.hpp>
+
+#include "../../../implementation/message/include/deserializer.hpp"
+#include "../../../implementation/message/include/message_impl.hpp"
+#include "../../../implementation/message/include/message_pool.hpp"
+#include "../../../implementation/message/include/payload_impl.hpp"
+
+namespace {
+const std::size_t pool_capacity = 8;
+const std::uint32_t buffer_shrink_threshold = 1;
+
+// Notification with a payload of _size bytes
+std::vector<vsomeip_v3::byte_t> make_message(std::size_t _size) {
+    const std::uint32_t its_length = static_cast<std::uint32_t>(8 + _size);
+    std::vector<vsomeip_v3::byte_t> its_message{0x12,
+                                                0x34,
+                                                0x80,
+                                                0x01,
+                                                static_cast<vsomeip_v3::byte_t>(its_length >> 24),
+                                                static_cast<vsomeip_v3::byte_t>(its_length >> 16),
+                                                static_cast<vsomeip_v3::byte_t>(its_length >> 8),
+                                                static_cast<vsomeip_v3::byte_t>(its_length),
+                                                0x00,
+                                                0x00,
+                                                0x00,
+                                                0x01,
+                                                0x01,
+                                                0x01,
+                                                0x02,
+                                                0x00};
+    its_message.resize(its_message.size() + _size, 0x55);
+    return its_message;
+}
+
+// Leaves a payload buffer with a capacity of _size bytes in the pool
+void recycle_buffer(std::size_t _size) {
+    auto its_payload = vsomeip_v3::message_pool::create_payload();
+    its_payload->set_data(std::vector<vsomeip_v3::byte_t>(_size, 0xaa));
+}
+
+class message_pool_test : public ::testing::Test {
+protected:
+    void SetUp() override { vsomeip_v3::message_pool::set_capacity(pool_capacity); }
+    void TearDown() override { vsomeip_v3::message_pool::set_capacity(0); }
+};
+}
+
+TEST_F(message_pool_test, recycles_messages_and_payloads) {
+    auto its_message = vsomeip_v3::message_pool::create_message();
+    const void* its_message_memory = its_message.get();
+    its_message.reset();
+
+    auto its_payload = vsomeip_v3::message_pool::create_payload();
+    const void* its_payload_memory = its_payload.get();
+    its_payload.reset();
+
+    // Checks.
+    ASSERT_EQ(vsomeip_v3::message_pool::create_message().get(), its_message_memory);
+    ASSERT_EQ(vsomeip_v3::message_pool::create_payload().get(), its_payload_memory);
+}
+
+TEST_F(message_pool_test, reused_message_is_reset) {
+    auto its_message = vsomeip_v3::message_pool::create_message();
+    const void* its_memory = its_message.get();
+    its_message->set_service(0x1234);
+    its_message->set_method(0x8001);
+    its_message->set_message_type(vsomeip_v3::message_type_e::MT_NOTIFICATION);
+    its_message->get_payload()->set_data(std::vector<vsomeip_v3::byte_t>(64, 0xaa));
+    its_message.reset();
+
+    its_message = vsomeip_v3::message_pool::create_message();
+
+    // Checks.
+    ASSERT_EQ(its_message.get(), its_memory);
+    ASSERT_EQ(its_message->get_service(), 0x0000);
+    ASSERT_EQ(its_message->get_method(), 0x0000);
+    ASSERT_EQ(its_message->get_message_type(), vsomeip_v3::message_type_e::MT_UNKNOWN);
+    ASSERT_EQ(its_message->get_payload()->get_length(), 0u);
+}
+
+TEST_F(message_pool_test, reused_payload_is_reset) {
+    recycle_buffer(64);
+
+    auto its_payload = vsomeip_v3::message_pool::create_payload();
+
+    // Checks.
+    ASSERT_EQ(its_payload->get_length(), 0u);
+}
+
+TEST_F(message_pool_test, deserializes_empty_payload_into_recycled_buffer) {
+    recycle_buffer(64);
+    const auto its_data = make_message(0);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    auto its_message = its_deserializer.deserialize_message(its_data.data(), its_data.size());
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_EQ(its_message->get_service(), 0x1234);
+    ASSERT_EQ(its_message->get_payload()->get_length(), 0u);
+}
+
+TEST_F(message_pool_test, deserializes_payload_into_larger_recycled_buffer) {
+    recycle_buffer(256);
+    const auto its_data = make_message(16);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    auto its_message = its_deserializer.deserialize_message(its_data.data(), its_data.size());
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_EQ(its_message->get_payload()->get_length(), 16u);
+    ASSERT_EQ(its_message->get_payload()->get_data()[15], 0x55);
+}
+
+TEST_F(message_pool_test, capacity_applies_to_next_deserialize_only) {
+    vsomeip_v3::payload_impl its_payload;
+    its_payload.set_capacity(0);
+    std::vector<vsomeip_v3::byte_t> its_data(8, 0x55);
+    vsomeip_v3::deserializer its_deserializer(its_data.data(), its_data.size(), buffer_shrink_threshold);
+
+    ASSERT_TRUE(its_payload.deserialize(&its_deserializer));
+    ASSERT_EQ(its_payload.get_length(), 0u);
+
+    // Without a capacity, the reserved size of the buffer is read
+    std::vector<vsomeip_v3::byte_t> its_buffer;
+    its_buffer.reserve(4);
+    its_payload.set_data(std::move(its_buffer));
+    ASSERT_TRUE(its_payload.deserialize(&its_deserializer));
+    ASSERT_EQ(its_payload.get_length(), 4u);
+}
+
+TEST(message_pool_disabled_test, empty_payload) {
+    const auto its_data = make_message(0);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    auto its_message = its_deserializer.deserialize_message(its_data.data(), its_data.size());
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_EQ(its_message->get_payload()->get_length(), 0u);
+}
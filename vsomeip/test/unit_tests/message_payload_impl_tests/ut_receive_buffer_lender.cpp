@@ -0,0 +1,185 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <vsomeip/payload.hpp>
+
+#include "../../../implementation/message/include/deserializer.hpp"
+#include "../../../implementation/message/include/external_payload_impl.hpp"
+#include "../../../implementation/message/include/message_impl.hpp"
+#include "../../../implementation/message/include/receive_buffer_lender.hpp"
+
+namespace {
+const std::uint32_t buffer_shrink_threshold = 1;
+const std::size_t payload_size = 2048;
+
+// Receive buffer holding a notification with a payload of _size bytes at _offset
+std::vector<vsomeip_v3::byte_t> make_buffer(std::size_t _offset, std::size_t _size) {
+    std::vector<vsomeip_v3::byte_t> its_buffer(_offset + 16 + _size + 64, 0);
+    const std::uint32_t its_length = static_cast<std::uint32_t>(8 + _size);
+    vsomeip_v3::byte_t* its_header = &its_buffer[_offset];
+    its_header[0] = 0x12; // service
+    its_header[1] = 0x34;
+    its_header[2] = 0x80; // event
+    its_header[3] = 0x01;
+    its_header[4] = static_cast<vsomeip_v3::byte_t>(its_length >> 24);
+    its_header[5] = static_cast<vsomeip_v3::byte_t>(its_length >> 16);
+    its_header[6] = static_cast<vsomeip_v3::byte_t>(its_length >> 8);
+    its_header[7] = static_cast<vsomeip_v3::byte_t>(its_length);
+    its_header[12] = 0x01; // protocol version
+    its_header[14] = 0x02; // notification
+    for (std::size_t i = 0; i < _size; i++) {
+        its_header[16 + i] = static_cast<vsomeip_v3::byte_t>(i);
+    }
+    return its_buffer;
+}
+}
+
+TEST(receive_buffer_lender_test, payload_references_lent_buffer) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(8, payload_size);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    std::shared_ptr<vsomeip_v3::message_impl> its_message;
+    {
+        vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+        its_message = its_deserializer.deserialize_message(&its_buffer[8], 16 + payload_size);
+    }
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_EQ(its_message->get_service(), 0x1234);
+    auto its_payload = std::dynamic_pointer_cast<vsomeip_v3::external_payload_impl>(its_message->get_payload());
+    ASSERT_TRUE(its_payload);
+    ASSERT_TRUE(its_payload->is_external());
+    ASSERT_EQ(its_payload->get_length(), payload_size);
+    ASSERT_EQ(its_payload->get_data()[100], 100);
+}
+
+TEST(receive_buffer_lender_test, reclaim_hands_memory_to_payloads) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(0, payload_size);
+    const vsomeip_v3::byte_t* its_memory = its_buffer.data();
+    its_buffer[16 + payload_size] = 0xab; // start of the next, incomplete message
+    const auto its_content{its_buffer};
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+    auto its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+    ASSERT_TRUE(its_message);
+    const vsomeip_v3::byte_t* its_data = its_message->get_payload()->get_data();
+    ASSERT_EQ(its_data, its_memory + 16);
+
+    ASSERT_TRUE(its_lending.reclaim(16 + payload_size, 1));
+
+    // Checks.
+    ASSERT_NE(its_buffer.data(), its_memory);
+    ASSERT_EQ(its_buffer[0], 0xab);
+    ASSERT_EQ(its_message->get_payload()->get_data(), its_data);
+    ASSERT_EQ(its_data[200], 200);
+
+    // Once the payload is gone, its memory is the next spare
+    its_message.reset();
+    std::copy(its_content.begin(), its_content.end(), its_buffer.begin());
+    its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+    ASSERT_TRUE(its_lending.reclaim(0, 0));
+    ASSERT_EQ(its_buffer.data(), its_memory);
+}
+
+TEST(receive_buffer_lender_test, copies_without_scope) {
+    auto its_buffer = make_buffer(0, payload_size);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    auto its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_FALSE(std::dynamic_pointer_cast<vsomeip_v3::external_payload_impl>(its_message->get_payload()));
+    ASSERT_EQ(its_message->get_payload()->get_length(), payload_size);
+}
+
+TEST(receive_buffer_lender_test, copies_small_payloads) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(0, 16);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+    auto its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + 16);
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_FALSE(std::dynamic_pointer_cast<vsomeip_v3::external_payload_impl>(its_message->get_payload()));
+    ASSERT_FALSE(its_lending.reclaim(0, 0));
+}
+
+TEST(receive_buffer_lender_test, copies_payloads_of_much_larger_buffers) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(0, payload_size);
+    its_buffer.resize(64 * payload_size);
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+    auto its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_FALSE(std::dynamic_pointer_cast<vsomeip_v3::external_payload_impl>(its_message->get_payload()));
+    ASSERT_FALSE(its_lending.reclaim(0, 0));
+}
+
+TEST(receive_buffer_lender_test, copies_once_lent_buffers_are_exhausted) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(0, payload_size);
+    const auto its_content{its_buffer};
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    std::vector<std::shared_ptr<vsomeip_v3::message_impl>> its_messages;
+    std::size_t its_lent{0};
+    vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer);
+    for (int i = 0; i < 8; i++) {
+        std::copy(its_content.begin(), its_content.end(), its_buffer.begin());
+        its_messages.push_back(its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size));
+        ASSERT_TRUE(its_messages.back());
+        ASSERT_EQ(its_messages.back()->get_payload()->get_data()[100], 100);
+        if (its_lending.reclaim(0, 0)) {
+            its_lent++;
+        }
+    }
+
+    // Checks.
+    ASSERT_EQ(its_lent, 4u);
+
+    // Buffers given back may be lent again
+    its_messages.clear();
+    std::copy(its_content.begin(), its_content.end(), its_buffer.begin());
+    auto its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+    ASSERT_TRUE(std::dynamic_pointer_cast<vsomeip_v3::external_payload_impl>(its_message->get_payload()));
+}
+
+TEST(receive_buffer_lender_test, scope_end_keeps_remainder) {
+    vsomeip_v3::receive_buffer_lender its_lender;
+    auto its_buffer = make_buffer(0, payload_size);
+    const vsomeip_v3::byte_t* its_memory = its_buffer.data();
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+
+    std::size_t its_remainder{16 + payload_size};
+    std::shared_ptr<vsomeip_v3::message_impl> its_message;
+    {
+        vsomeip_v3::receive_buffer_lender::scope its_lending(its_lender, its_buffer, its_remainder);
+        its_message = its_deserializer.deserialize_message(its_buffer.data(), 16 + payload_size);
+        its_remainder = 3;
+    }
+
+    // Checks.
+    ASSERT_TRUE(its_message);
+    ASSERT_NE(its_buffer.data(), its_memory);
+    ASSERT_EQ(its_buffer[0], 0x12);
+    ASSERT_EQ(its_buffer[2], 0x80);
+    ASSERT_EQ(its_buffer[3], 0x00);
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/protocol/include/protocol.hpp"
+#include "../../../implementation/protocol/include/register_events_command.hpp"
+
+namespace register_events_command_tests {
+
+const vsomeip_v3::client_t client = 0x0001;
+// Command header plus 8 registrations with two eventgroups each
+const std::size_t max_size = vsomeip_v3::protocol::COMMAND_HEADER_SIZE + 8 * 16;
+
+std::vector<vsomeip_v3::protocol::register_event> make_registrations(std::size_t _count) {
+    std::vector<vsomeip_v3::protocol::register_event> its_registrations;
+    for (std::size_t i = 0; i < _count; i++) {
+        const std::set<vsomeip_v3::eventgroup_t> its_eventgroups{0x0001, 0x0002};
+        its_registrations.emplace_back(0x1234, 0x5678, static_cast<vsomeip_v3::event_t>(0x8000 + i), vsomeip_v3::event_type_e::ET_EVENT,
+                                       true, vsomeip_v3::reliability_type_e::RT_UNRELIABLE, false,
+                                       static_cast<uint16_t>(its_eventgroups.size()), its_eventgroups);
+    }
+    return its_registrations;
+}
+
+TEST(register_events_command_test, split_fills_commands_up_to_max_size) {
+    const auto its_registrations = make_registrations(20);
+
+    std::vector<vsomeip_v3::protocol::register_events_command> its_commands;
+    ASSERT_TRUE(vsomeip_v3::protocol::register_events_command::split(client, its_registrations, max_size, its_commands));
+
+    // Checks.
+    ASSERT_EQ(its_commands.size(), 3u);
+    vsomeip_v3::event_t its_next_event = 0x8000;
+    for (const auto& its_command : its_commands) {
+        std::vector<vsomeip_v3::byte_t> its_buffer;
+        vsomeip_v3::protocol::error_e its_error;
+        its_command.serialize(its_buffer, its_error);
+        ASSERT_EQ(its_error, vsomeip_v3::protocol::error_e::ERROR_OK);
+        ASSERT_LE(its_buffer.size(), max_size);
+        ASSERT_EQ(its_command.get_client(), client);
+
+        // The registrations keep their order
+        vsomeip_v3::protocol::register_events_command its_received;
+        its_received.deserialize(its_buffer, its_error);
+        ASSERT_EQ(its_error, vsomeip_v3::protocol::error_e::ERROR_OK);
+        for (std::size_t i = 0; i < its_received.get_num_registrations(); i++) {
+            vsomeip_v3::protocol::register_event its_registration;
+            ASSERT_TRUE(its_received.get_registration_at(i, its_registration));
+            ASSERT_EQ(its_registration.get_event(), its_next_event++);
+        }
+    }
+    ASSERT_EQ(its_next_event, 0x8000 + its_registrations.size());
+}
+
+TEST(register_events_command_test, split_exact_fit) {
+    const auto its_registrations = make_registrations(8);
+
+    std::vector<vsomeip_v3::protocol::register_events_command> its_commands;
+    ASSERT_TRUE(vsomeip_v3::protocol::register_events_command::split(client, its_registrations, max_size, its_commands));
+
+    // Checks.
+    ASSERT_EQ(its_commands.size(), 1u);
+    ASSERT_EQ(its_commands.front().get_num_registrations(), 8u);
+}
+
+TEST(register_events_command_test, split_rejects_oversized_registration) {
+    auto its_registrations = make_registrations(10);
+    std::set<vsomeip_v3::eventgroup_t> its_eventgroups;
+    for (vsomeip_v3::eventgroup_t i = 1; i <= 100; i++) {
+        its_eventgroups.insert(i);
+    }
+    its_registrations[9].set_eventgroups(its_eventgroups);
+
+    std::vector<vsomeip_v3::protocol::register_events_command> its_commands;
+
+    // Checks.
+    ASSERT_FALSE(vsomeip_v3::protocol::register_events_command::split(client, its_registrations, max_size, its_commands));
+    ASSERT_EQ(its_commands.size(), 2u);
+    ASSERT_EQ(its_commands[0].get_num_registrations() + its_commands[1].get_num_registrations(), 9u);
+}
+
+} // namespace register_events_command_tests
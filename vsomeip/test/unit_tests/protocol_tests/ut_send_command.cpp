@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/protocol/include/protocol.hpp"
+#include "../../../implementation/protocol/include/send_command.hpp"
+
+namespace send_command_tests {
+
+// Tester Note: Expect Little-Endian representation for serialized data.
+const std::vector<std::uint8_t> serialized_send_command = {
+        0x18, // send_command
+        0x00, 0x00, // Version.
+        0x01, 0x00, // Client.
+        0x0a, 0x00, 0x00, 0x00, // Size.
+        0x34, 0x12, // Instance.
+        0x01, // Reliable.
+        0x00, // Status.
+        0x02, 0x00, // Target.
+        0x11, 0x22, 0x33, 0x44 // Message.
+};
+
+const std::vector<std::uint8_t> message = {0x11, 0x22, 0x33, 0x44};
+
+vsomeip_v3::protocol::send_command make_command() {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    command.set_client(0x0001);
+    command.set_instance(0x1234);
+    command.set_reliable(true);
+    command.set_status(0x00);
+    command.set_target(0x0002);
+    return command;
+}
+
+TEST(send_command_test, serialize) {
+    auto command = make_command();
+    command.set_message(message);
+
+    std::vector<std::uint8_t> buffer;
+    vsomeip_v3::protocol::error_e error;
+    command.serialize(buffer, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    ASSERT_EQ(buffer, serialized_send_command);
+}
+
+TEST(send_command_test, serialize_header) {
+    auto command = make_command();
+
+    std::vector<std::uint8_t> buffer;
+    vsomeip_v3::protocol::error_e error;
+    command.serialize_header(buffer, message.size(), error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    ASSERT_EQ(buffer.size(), serialized_send_command.size() - message.size());
+
+    // The message sent behind the header completes the command
+    buffer.insert(buffer.end(), message.begin(), message.end());
+    ASSERT_EQ(buffer, serialized_send_command);
+}
+
+TEST(send_command_test, deserialize) {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    vsomeip_v3::protocol::error_e error;
+    command.deserialize(serialized_send_command, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    EXPECT_EQ(command.get_instance(), 0x1234);
+    EXPECT_TRUE(command.is_reliable());
+    EXPECT_EQ(command.get_target(), 0x0002);
+    EXPECT_EQ(command.get_message(), message);
+}
+
+} // namespace send_command_tests
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+
+#include "../../../implementation/runtime/include/dispatch_slot.hpp"
+
+namespace {
+using slot_t = vsomeip_v3::dispatch_slot<int>;
+
+const std::chrono::milliseconds max_dispatch_time{100};
+const std::chrono::steady_clock::time_point started{std::chrono::seconds(1)};
+}
+
+TEST(dispatch_slot_test, idle_slot_is_not_reported) {
+    slot_t its_slot;
+
+    // Checks.
+    ASSERT_FALSE(its_slot.is_running());
+    ASSERT_EQ(its_slot.check(started + 2 * max_dispatch_time, max_dispatch_time), nullptr);
+}
+
+TEST(dispatch_slot_test, reports_blocking_handler_once) {
+    slot_t its_slot;
+    auto its_handler = std::make_shared<int>(1);
+    its_slot.enter(its_handler, started);
+
+    // Checks.
+    ASSERT_TRUE(its_slot.is_running());
+    ASSERT_EQ(its_slot.check(started + max_dispatch_time / 2, max_dispatch_time), nullptr);
+    ASSERT_EQ(its_slot.check(started + max_dispatch_time, max_dispatch_time), its_handler);
+    ASSERT_EQ(its_slot.check(started + 2 * max_dispatch_time, max_dispatch_time), nullptr);
+}
+
+TEST(dispatch_slot_test, leave_ends_blocking) {
+    slot_t its_slot;
+    its_slot.enter(std::make_shared<int>(1), started);
+    its_slot.leave();
+
+    // Checks.
+    ASSERT_FALSE(its_slot.is_running());
+    ASSERT_EQ(its_slot.check(started + 2 * max_dispatch_time, max_dispatch_time), nullptr);
+}
+
+TEST(dispatch_slot_test, next_handler_is_reported_again) {
+    slot_t its_slot;
+    auto its_first = std::make_shared<int>(1);
+    auto its_second = std::make_shared<int>(2);
+
+    its_slot.enter(its_first, started);
+    ASSERT_EQ(its_slot.check(started + max_dispatch_time, max_dispatch_time), its_first);
+    its_slot.leave();
+
+    its_slot.enter(its_second, started + max_dispatch_time);
+
+    // Checks.
+    ASSERT_EQ(its_slot.check(started + max_dispatch_time, max_dispatch_time), nullptr);
+    ASSERT_EQ(its_slot.check(started + 2 * max_dispatch_time, max_dispatch_time), its_second);
+}
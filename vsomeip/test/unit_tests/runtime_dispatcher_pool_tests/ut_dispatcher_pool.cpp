@@ -0,0 +1,218 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/runtime/include/dispatcher_pool.hpp"
+
+using pool_t = vsomeip_v3::dispatcher_pool<int, std::function<void()>>;
+
+namespace {
+std::vector<std::thread> start_dispatchers(pool_t& _pool) {
+    std::vector<std::thread> its_threads;
+    for (std::size_t i = 0; i < _pool.size(); i++) {
+        its_threads.emplace_back([&_pool, i] {
+            int its_key{0};
+            std::function<void()> its_task;
+            while (_pool.pop(i, its_key, its_task)) {
+                its_task();
+                _pool.complete(its_key);
+            }
+        });
+    }
+    return its_threads;
+}
+
+void stop_dispatchers(pool_t& _pool, std::vector<std::thread>& _threads) {
+    _pool.stop();
+    for (auto& t : _threads) {
+        t.join();
+    }
+}
+}
+
+TEST(dispatcher_pool_test, keeps_order_per_key) {
+    const int key_count{8};
+    const int tasks_per_key{1000};
+
+    pool_t its_pool{4};
+    auto its_threads = start_dispatchers(its_pool);
+
+    std::mutex its_mutex;
+    std::map<int, std::vector<int>> its_runs;
+    std::atomic<int> its_running[key_count]{};
+    std::atomic<bool> has_overlap{false};
+    std::promise<void> its_done;
+    std::atomic<int> its_remaining{key_count * tasks_per_key};
+
+    for (int i = 0; i < tasks_per_key; i++) {
+        for (int key = 0; key < key_count; key++) {
+            its_pool.push(key, [&, key, i] {
+                if (its_running[key]++ != 0) {
+                    has_overlap = true;
+                }
+                {
+                    std::scoped_lock its_lock{its_mutex};
+                    its_runs[key].push_back(i);
+                }
+                its_running[key]--;
+                if (--its_remaining == 0) {
+                    its_done.set_value();
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(its_done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    stop_dispatchers(its_pool, its_threads);
+
+    EXPECT_FALSE(has_overlap);
+    for (int key = 0; key < key_count; key++) {
+        ASSERT_EQ(its_runs[key].size(), static_cast<std::size_t>(tasks_per_key));
+        for (int i = 0; i < tasks_per_key; i++) {
+            EXPECT_EQ(its_runs[key][static_cast<std::size_t>(i)], i);
+        }
+    }
+}
+
+TEST(dispatcher_pool_test, blocking_key_does_not_block_others) {
+    pool_t its_pool{2};
+    auto its_threads = start_dispatchers(its_pool);
+
+    // Keys 0 and 2 have the same home queue, key 0 blocks until key 2 ran
+    std::promise<void> its_release;
+    auto its_released = its_release.get_future().share();
+    std::promise<void> its_done;
+
+    its_pool.push(0, [its_released] { its_released.wait(); });
+    its_pool.push(2, [&its_release] { its_release.set_value(); });
+    its_pool.push(0, [&its_done] { its_done.set_value(); });
+
+    EXPECT_EQ(its_done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    stop_dispatchers(its_pool, its_threads);
+}
+
+TEST(dispatcher_pool_test, exclusive_task_runs_alone_in_push_order) {
+    pool_t its_pool{4};
+    auto its_threads = start_dispatchers(its_pool);
+
+    // Key 0 blocks until released, the exclusive task and key 1 must wait for it
+    std::promise<void> its_release;
+    auto its_released = its_release.get_future().share();
+    std::mutex its_mutex;
+    std::vector<int> its_runs;
+    std::promise<void> its_done;
+    auto record = [&](int _run) {
+        std::scoped_lock its_lock{its_mutex};
+        its_runs.push_back(_run);
+    };
+
+    its_pool.push(0, [&, its_released] {
+        its_released.wait();
+        record(0);
+    });
+    its_pool.push_exclusive(-1, [&] { record(-1); });
+    its_pool.push(1, [&] { record(1); });
+    its_pool.push(2, [&] {
+        record(2);
+        its_done.set_value();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::scoped_lock its_lock{its_mutex};
+        EXPECT_TRUE(its_runs.empty());
+    }
+    its_release.set_value();
+
+    ASSERT_EQ(its_done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    stop_dispatchers(its_pool, its_threads);
+
+    // Checks.
+    ASSERT_EQ(its_runs.size(), 4u);
+    EXPECT_EQ(its_runs[0], 0);
+    EXPECT_EQ(its_runs[1], -1);
+}
+
+TEST(dispatcher_pool_test, exclusive_tasks_keep_order_with_others) {
+    const int task_count{2000};
+
+    pool_t its_pool{4};
+    auto its_threads = start_dispatchers(its_pool);
+
+    std::atomic<int> its_running{0};
+    std::atomic<bool> has_overlap{false};
+    std::atomic<int> its_completed{0};
+    std::atomic<bool> is_out_of_order{false};
+    std::promise<void> its_done;
+
+    // Every 100th task is exclusive, it must find all tasks before it completed
+    for (int i = 0; i < task_count; i++) {
+        if (i % 100 == 99) {
+            its_pool.push_exclusive(-1, [&, i] {
+                if (its_running++ != 0) {
+                    has_overlap = true;
+                }
+                if (its_completed != i) {
+                    is_out_of_order = true;
+                }
+                its_running--;
+                if (++its_completed == task_count) {
+                    its_done.set_value();
+                }
+            });
+        } else {
+            its_pool.push(i % 8, [&, i] {
+                its_running++;
+                if (its_completed < i - i % 100) {
+                    is_out_of_order = true;
+                }
+                its_running--;
+                if (++its_completed == task_count) {
+                    its_done.set_value();
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(its_done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    stop_dispatchers(its_pool, its_threads);
+
+    // Checks.
+    EXPECT_FALSE(has_overlap);
+    EXPECT_FALSE(is_out_of_order);
+}
+
+TEST(dispatcher_pool_test, stop_and_clear) {
+    pool_t its_pool{1};
+
+    std::atomic<int> its_count{0};
+    for (int i = 0; i < 10; i++) {
+        its_pool.push(i, [&its_count] { its_count++; });
+    }
+    its_pool.clear();
+
+    // Stopped pool returns without taking pending tasks
+    its_pool.stop();
+    its_pool.push(1, [&its_count] { its_count++; });
+    int its_key{0};
+    std::function<void()> its_task;
+    EXPECT_FALSE(its_pool.pop(0, its_key, its_task));
+
+    its_pool.start();
+    ASSERT_TRUE(its_pool.pop(0, its_key, its_task));
+    EXPECT_EQ(its_key, 1);
+    its_task();
+    its_pool.complete(its_key);
+    EXPECT_EQ(its_count, 1);
+}
@@ -0,0 +1,187 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/utility/include/free_list.hpp"
+
+// Counts the heap allocations of the whole test binary. GCC does not see
+// that the replaced operators pair malloc and free.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+}
+
+void* operator new(std::size_t _size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* its_memory = std::malloc(_size ? _size : 1)) {
+        return its_memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* _memory) noexcept {
+    std::free(_memory);
+}
+
+void operator delete(void* _memory, std::size_t) noexcept {
+    std::free(_memory);
+}
+
+namespace {
+const std::size_t batch_size{4};
+
+// One type per test, the thread local lists are shared by all free lists of a type
+template<int Tag_>
+struct record {
+    int value_{0};
+};
+
+template<int Tag_>
+using list_t = vsomeip_v3::free_list<std::shared_ptr<record<Tag_>>>;
+
+// Counts the records that are not kept
+std::atomic<std::size_t> disposed{0};
+
+struct count_dispose {
+    void operator()(std::shared_ptr<record<5>>&&) const { disposed++; }
+};
+}
+
+TEST(free_list_test, empty_without_release) {
+    list_t<0> its_list;
+
+    // Checks.
+    ASSERT_EQ(its_list.acquire(), nullptr);
+}
+
+TEST(free_list_test, reuses_on_same_thread) {
+    list_t<1> its_list;
+    auto its_record = std::make_shared<record<1>>();
+    const auto its_memory = its_record.get();
+
+    its_list.release(std::move(its_record), batch_size);
+
+    // Checks.
+    ASSERT_EQ(its_list.acquire().get(), its_memory);
+    ASSERT_EQ(its_list.acquire(), nullptr);
+}
+
+TEST(free_list_test, hands_over_full_batch_to_other_thread) {
+    list_t<2> its_list;
+    std::set<const record<2>*> its_released;
+
+    // Release a batch and one more record on the dispatching thread
+    std::thread its_thread{[&] {
+        for (std::size_t i = 0; i < batch_size + 1; i++) {
+            auto its_record = std::make_shared<record<2>>();
+            if (i < batch_size) {
+                its_released.insert(its_record.get());
+            }
+            its_list.release(std::move(its_record), batch_size);
+        }
+    }};
+    its_thread.join();
+
+    std::set<const record<2>*> its_acquired;
+    for (std::size_t i = 0; i < batch_size; i++) {
+        auto its_record = its_list.acquire();
+        ASSERT_NE(its_record, nullptr);
+        its_acquired.insert(its_record.get());
+    }
+
+    // Checks.
+    ASSERT_EQ(its_acquired, its_released);
+    // The incomplete batch stays with the releasing thread
+    ASSERT_EQ(its_list.acquire(), nullptr);
+}
+
+TEST(free_list_test, drops_batch_not_taken) {
+    list_t<3> its_list;
+    std::vector<std::weak_ptr<record<3>>> its_first_batch;
+
+    std::thread its_thread{[&] {
+        for (std::size_t i = 0; i < 2 * batch_size; i++) {
+            auto its_record = std::make_shared<record<3>>();
+            if (i < batch_size) {
+                its_first_batch.push_back(its_record);
+            }
+            its_list.release(std::move(its_record), batch_size);
+        }
+    }};
+    its_thread.join();
+
+    // Checks.
+    for (const auto& its_record : its_first_batch) {
+        ASSERT_TRUE(its_record.expired());
+    }
+    for (std::size_t i = 0; i < batch_size; i++) {
+        ASSERT_NE(its_list.acquire(), nullptr);
+    }
+    ASSERT_EQ(its_list.acquire(), nullptr);
+}
+
+TEST(free_list_test, warm_cycle_does_not_allocate) {
+    list_t<4> its_list;
+    std::vector<std::shared_ptr<record<4>>> its_records;
+    its_records.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; i++) {
+        its_list.release(std::make_shared<record<4>>(), batch_size);
+    }
+
+    // Acquires a full batch and releases it again, which hands it over
+    auto cycle = [&] {
+        for (std::size_t i = 0; i < batch_size; i++) {
+            its_records.push_back(its_list.acquire());
+        }
+        for (auto& its_record : its_records) {
+            its_list.release(std::move(its_record), batch_size);
+        }
+        its_records.clear();
+    };
+    cycle();
+    cycle();
+
+    const std::size_t its_start{allocations};
+    for (int i = 0; i < 16; i++) {
+        cycle();
+    }
+
+    // Checks.
+    ASSERT_EQ(allocations - its_start, 0u);
+    for (std::size_t i = 0; i < batch_size; i++) {
+        ASSERT_NE(its_list.acquire(), nullptr);
+    }
+}
+
+TEST(free_list_test, disposes_records_not_kept) {
+    vsomeip_v3::free_list<std::shared_ptr<record<5>>, count_dispose> its_list;
+
+    // A batch size of 0 keeps nothing
+    its_list.release(std::make_shared<record<5>>(), 0);
+    ASSERT_EQ(disposed, 1u);
+
+    // The list of a thread that ends is not handed over
+    std::thread its_thread{[&] {
+        for (std::size_t i = 0; i < batch_size - 1; i++) {
+            its_list.release(std::make_shared<record<5>>(), batch_size);
+        }
+    }};
+    its_thread.join();
+
+    // Checks.
+    ASSERT_EQ(disposed, batch_size);
+    ASSERT_EQ(its_list.acquire(), nullptr);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "correlation_table.hpp"
+
+namespace {
+using table_t = CorrelationTable<std::uint16_t>;
+
+const std::chrono::seconds timeout(1);
+}
+
+TEST(correlation_table_test, take_matches_inserted_entry) {
+    table_t its_table(4);
+    const auto its_now = table_t::Clock::now();
+
+    const auto its_id = its_table.insert(0x1234, its_now + timeout);
+    ASSERT_NE(its_id, 0u);
+    ASSERT_EQ(its_table.size(), 1u);
+
+    std::uint16_t its_session{0};
+
+    // Checks.
+    ASSERT_TRUE(its_table.take(its_id, its_session));
+    ASSERT_EQ(its_session, 0x1234);
+    ASSERT_EQ(its_table.size(), 0u);
+    ASSERT_FALSE(its_table.take(its_id, its_session));
+}
+
+TEST(correlation_table_test, unknown_ids_do_not_match) {
+    table_t its_table(4);
+    const auto its_id = its_table.insert(0x1234, table_t::Clock::now() + timeout);
+
+    std::uint16_t its_session{0};
+
+    // Checks.
+    ASSERT_FALSE(its_table.take(0, its_session));
+    ASSERT_FALSE(its_table.take(its_id + 1, its_session));
+    ASSERT_FALSE(its_table.take(its_id + (std::uint64_t(1) << 32), its_session));
+    ASSERT_EQ(its_table.size(), 1u);
+}
+
+TEST(correlation_table_test, duplicate_sessions_get_own_ids) {
+    table_t its_table(4);
+    const auto its_now = table_t::Clock::now();
+
+    const auto its_first = its_table.insert(0x1234, its_now + timeout);
+    const auto its_second = its_table.insert(0x1234, its_now + timeout);
+    ASSERT_NE(its_first, its_second);
+
+    std::uint16_t its_session{0};
+
+    // Checks.
+    ASSERT_TRUE(its_table.take(its_second, its_session));
+    ASSERT_EQ(its_session, 0x1234);
+    ASSERT_FALSE(its_table.take(its_second, its_session));
+    ASSERT_TRUE(its_table.take(its_first, its_session));
+    ASSERT_EQ(its_session, 0x1234);
+}
+
+TEST(correlation_table_test, id_of_answered_entry_does_not_match_slot_reuse) {
+    table_t its_table(1);
+    const auto its_now = table_t::Clock::now();
+
+    const auto its_old = its_table.insert(0x0001, its_now + timeout);
+    std::uint16_t its_session{0};
+    ASSERT_TRUE(its_table.take(its_old, its_session));
+    const auto its_new = its_table.insert(0x0002, its_now + timeout);
+
+    // Checks.
+    ASSERT_NE(its_new, its_old);
+    ASSERT_FALSE(its_table.take(its_old, its_session));
+    ASSERT_TRUE(its_table.take(its_new, its_session));
+    ASSERT_EQ(its_session, 0x0002);
+}
+
+TEST(correlation_table_test, expire_removes_entries_past_deadline) {
+    table_t its_table(4);
+    const auto its_now = table_t::Clock::now();
+
+    const auto its_expiring = its_table.insert(0x0001, its_now);
+    const auto its_waiting = its_table.insert(0x0002, its_now + timeout);
+
+    std::vector<std::uint16_t> its_expired;
+    const auto its_count = its_table.expire(its_now, [&its_expired](std::uint16_t&& _session) { its_expired.push_back(_session); });
+
+    // Checks.
+    ASSERT_EQ(its_count, 1u);
+    ASSERT_EQ(its_expired, std::vector<std::uint16_t>{0x0001});
+    ASSERT_EQ(its_table.size(), 1u);
+
+    std::uint16_t its_session{0};
+    ASSERT_FALSE(its_table.take(its_expiring, its_session));
+    ASSERT_TRUE(its_table.take(its_waiting, its_session));
+    ASSERT_EQ(its_session, 0x0002);
+}
+
+TEST(correlation_table_test, insert_fails_when_full) {
+    table_t its_table(2);
+    const auto its_now = table_t::Clock::now();
+
+    const auto its_first = its_table.insert(0x0001, its_now + timeout);
+    ASSERT_NE(its_first, 0u);
+    ASSERT_NE(its_table.insert(0x0002, its_now + timeout), 0u);
+
+    // Checks.
+    ASSERT_EQ(its_table.insert(0x0003, its_now + timeout), 0u);
+    ASSERT_EQ(its_table.size(), its_table.capacity());
+
+    // A freed slot is found again
+    std::uint16_t its_session{0};
+    ASSERT_TRUE(its_table.take(its_first, its_session));
+    ASSERT_NE(its_table.insert(0x0003, its_now + timeout), 0u);
+}
@@ -0,0 +1,153 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include "tunnel_control.hpp"
+
+namespace {
+iox::ImmutableSlice<uint8_t> slice_of(const std::vector<uint8_t>& _data, size_t _size) {
+    return iox::ImmutableSlice<uint8_t>(_data.data(), _size);
+}
+
+// Collects the event ids and group ids of all records in _data[0, _size)
+bool read_records(const std::vector<uint8_t>& _data, size_t _size, std::vector<uint16_t>& _events, std::vector<uint16_t>& _groups) {
+    return forEachEventRecord(slice_of(_data, _size), [&](const TunnelEventRecord& _record, const std::vector<uint16_t>& _record_groups) {
+        _events.push_back(_record.event_id);
+        _groups.insert(_groups.end(), _record_groups.begin(), _record_groups.end());
+    });
+}
+
+std::vector<uint8_t> make_records() {
+    const uint16_t its_groups[] = {0x0001, 0x0002};
+    std::vector<uint8_t> its_records;
+    appendEventRecord(its_records, 0x8001, EventType::Field, its_groups, 2);
+    appendEventRecord(its_records, 0x8002, EventType::Event, nullptr, 0);
+    return its_records;
+}
+}
+
+TEST(tunnel_control_test, reads_all_records) {
+    const auto its_records = make_records();
+    std::vector<uint16_t> its_events, its_groups;
+
+    // Checks.
+    ASSERT_TRUE(read_records(its_records, its_records.size(), its_events, its_groups));
+    ASSERT_EQ(its_events, (std::vector<uint16_t>{0x8001, 0x8002}));
+    ASSERT_EQ(its_groups, (std::vector<uint16_t>{0x0001, 0x0002}));
+}
+
+TEST(tunnel_control_test, empty_records_are_valid) {
+    const std::vector<uint8_t> its_records;
+    std::vector<uint16_t> its_events, its_groups;
+
+    // Checks.
+    ASSERT_TRUE(read_records(its_records, 0, its_events, its_groups));
+    ASSERT_TRUE(its_events.empty());
+}
+
+TEST(tunnel_control_test, truncated_record_header) {
+    const auto its_records = make_records();
+    const size_t its_first_size = sizeof(TunnelEventRecord) + 2 * sizeof(uint16_t);
+    std::vector<uint16_t> its_events, its_groups;
+
+    // Checks.
+    ASSERT_FALSE(read_records(its_records, its_first_size + sizeof(TunnelEventRecord) - 1, its_events, its_groups));
+    ASSERT_EQ(its_events, std::vector<uint16_t>{0x8001});
+
+    its_events.clear();
+    ASSERT_FALSE(read_records(its_records, 1, its_events, its_groups));
+    ASSERT_TRUE(its_events.empty());
+}
+
+TEST(tunnel_control_test, truncated_record_groups) {
+    const auto its_records = make_records();
+    std::vector<uint16_t> its_events, its_groups;
+
+    // Checks.
+    ASSERT_FALSE(read_records(its_records, sizeof(TunnelEventRecord) + sizeof(uint16_t), its_events, its_groups));
+    ASSERT_TRUE(its_events.empty());
+    ASSERT_TRUE(its_groups.empty());
+}
+
+TEST(tunnel_control_test, group_count_beyond_payload) {
+    std::vector<uint8_t> its_records;
+    appendEventRecord(its_records, 0x8001, EventType::Event, nullptr, 0);
+    its_records[offsetof(TunnelEventRecord, group_count)] = 0xff;
+    std::vector<uint16_t> its_events, its_groups;
+
+    // Checks.
+    ASSERT_FALSE(read_records(its_records, its_records.size(), its_events, its_groups));
+    ASSERT_TRUE(its_events.empty());
+}
+
+TEST(tunnel_control_test, reads_events_of_offer) {
+    const auto its_records = make_records();
+    std::vector<vsomeip_v3::event_registration_t> its_events;
+    std::set<vsomeip_v3::eventgroup_t> its_groups;
+
+    // Checks.
+    ASSERT_TRUE(readEvents(slice_of(its_records, its_records.size()), its_events, its_groups));
+    ASSERT_EQ(its_events.size(), 2u);
+    ASSERT_EQ(its_events[0].event_, 0x8001);
+    ASSERT_EQ(its_events[0].type_, vsomeip_v3::event_type_e::ET_FIELD);
+    ASSERT_EQ(its_events[0].eventgroups_, (std::set<vsomeip_v3::eventgroup_t>{0x0001, 0x0002}));
+    ASSERT_EQ(its_events[1].event_, 0x8002);
+    ASSERT_EQ(its_events[1].type_, vsomeip_v3::event_type_e::ET_EVENT);
+    ASSERT_EQ(its_groups, (std::set<vsomeip_v3::eventgroup_t>{0x0001, 0x0002}));
+}
+
+TEST(tunnel_control_test, truncated_offer_reads_no_events) {
+    const auto its_records = make_records();
+    std::vector<vsomeip_v3::event_registration_t> its_events;
+    std::set<vsomeip_v3::eventgroup_t> its_groups;
+
+    // Checks.
+    ASSERT_FALSE(readEvents(slice_of(its_records, its_records.size() - 1), its_events, its_groups));
+    ASSERT_TRUE(its_events.empty());
+    ASSERT_TRUE(its_groups.empty());
+}
+
+TEST(tunnel_control_test, short_hello) {
+    const TunnelHello its_sent{1, 1, TUNNEL_FEATURES};
+    std::vector<uint8_t> its_payload(sizeof(its_sent));
+    std::memcpy(its_payload.data(), &its_sent, sizeof(its_sent));
+    TunnelHello its_hello{};
+
+    // Checks.
+    ASSERT_FALSE(readHello(slice_of(its_payload, 0), its_hello));
+    ASSERT_FALSE(readHello(slice_of(its_payload, sizeof(its_sent) - 1), its_hello));
+    ASSERT_TRUE(readHello(slice_of(its_payload, sizeof(its_sent)), its_hello));
+    ASSERT_EQ(its_hello.min_version, 1u);
+    ASSERT_EQ(its_hello.max_version, 1u);
+    ASSERT_EQ(its_hello.features, TUNNEL_FEATURES);
+}
+
+TEST(tunnel_control_test, hello_with_common_version) {
+    const auto its_answer = negotiateHello(TunnelHello{0, 0xffff, 0xffffffff});
+
+    // Checks.
+    ASSERT_EQ(its_answer.min_version, TUNNEL_PROTOCOL_VERSION);
+    ASSERT_EQ(its_answer.max_version, TUNNEL_PROTOCOL_VERSION);
+    ASSERT_EQ(its_answer.features, TUNNEL_FEATURES);
+}
+
+TEST(tunnel_control_test, hello_with_unknown_version) {
+    // Checks.
+    for (const auto& its_request : {TunnelHello{TUNNEL_PROTOCOL_VERSION + 1, 0xffff, TUNNEL_FEATURES},
+                                    TunnelHello{0, TUNNEL_PROTOCOL_VERSION - 1, TUNNEL_FEATURES},
+                                    TunnelHello{TUNNEL_PROTOCOL_VERSION + 1, TUNNEL_PROTOCOL_VERSION - 1, TUNNEL_FEATURES}}) {
+        const auto its_answer = negotiateHello(its_request);
+        ASSERT_EQ(its_answer.min_version, 0u);
+        ASSERT_EQ(its_answer.max_version, 0u);
+        ASSERT_EQ(its_answer.features, 0u);
+    }
+}
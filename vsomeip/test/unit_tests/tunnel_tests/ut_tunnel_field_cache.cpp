@@ -0,0 +1,73 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "tunnel_event_key.hpp"
+#include "tunnel_field_cache.hpp"
+
+TEST(tunnel_event_key_test, distinguishes_service_instance_and_event) {
+    // Checks.
+    ASSERT_EQ(eventKeyOf(0x1234, 0x5678, 0x8001), 0x123456788001u);
+    ASSERT_NE(eventKeyOf(0x0001, 0x0002, 0x0003), eventKeyOf(0x0002, 0x0001, 0x0003));
+    ASSERT_NE(eventKeyOf(0x0001, 0x0002, 0x0003), eventKeyOf(0x0001, 0x0003, 0x0002));
+    ASSERT_NE(eventKeyOf(0xffff, 0xffff, 0xffff), eventKeyOf(0xffff, 0xffff, 0xfffe));
+}
+
+TEST(tunnel_field_slots_test, assigns_slots_in_order) {
+    TunnelFieldSlots its_slots(4);
+
+    // Checks.
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8001), TunnelFieldSlots::NONE);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8001), 0u);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8002), 1u);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0002, 0x8001), 2u);
+    ASSERT_EQ(its_slots.used(), 3u);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8001), 0u);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8002), 1u);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0002, 0x8001), 2u);
+}
+
+TEST(tunnel_field_slots_test, reuses_released_slots) {
+    TunnelFieldSlots its_slots(4);
+    its_slots.assign(0x1234, 0x0001, 0x8001);
+    its_slots.assign(0x1234, 0x0001, 0x8002);
+    its_slots.assign(0x1234, 0x0001, 0x8003);
+
+    // Checks.
+    ASSERT_EQ(its_slots.release(0x1234, 0x0001, 0x8002), 1u);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8002), TunnelFieldSlots::NONE);
+    ASSERT_EQ(its_slots.release(0x1234, 0x0001, 0x8002), TunnelFieldSlots::NONE);
+
+    ASSERT_EQ(its_slots.assign(0x4321, 0x0001, 0x8001), 1u);
+    ASSERT_EQ(its_slots.used(), 3u);
+    ASSERT_EQ(its_slots.find(0x4321, 0x0001, 0x8001), 1u);
+}
+
+TEST(tunnel_field_slots_test, overflow) {
+    TunnelFieldSlots its_slots(2);
+    its_slots.assign(0x1234, 0x0001, 0x8001);
+    its_slots.assign(0x1234, 0x0001, 0x8002);
+
+    // Checks.
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8003), TunnelFieldSlots::NONE);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8003), TunnelFieldSlots::NONE);
+    ASSERT_EQ(its_slots.used(), 2u);
+
+    // A release makes room for the next field
+    ASSERT_EQ(its_slots.release(0x1234, 0x0001, 0x8001), 0u);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8003), 0u);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8004), TunnelFieldSlots::NONE);
+}
+
+TEST(tunnel_field_slots_test, release_of_unknown_field) {
+    TunnelFieldSlots its_slots(2);
+    its_slots.assign(0x1234, 0x0001, 0x8001);
+
+    // Checks.
+    ASSERT_EQ(its_slots.release(0x1234, 0x0002, 0x8001), TunnelFieldSlots::NONE);
+    ASSERT_EQ(its_slots.find(0x1234, 0x0001, 0x8001), 0u);
+    ASSERT_EQ(its_slots.assign(0x1234, 0x0001, 0x8002), 1u);
+}
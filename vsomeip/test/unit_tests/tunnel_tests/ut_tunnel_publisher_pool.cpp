@@ -0,0 +1,129 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "tunnel_publisher_pool.hpp"
+
+namespace {
+const size_t max_thread_ports = 4;
+
+class tunnel_publisher_pool_test : public ::testing::Test {
+protected:
+    tunnel_publisher_pool_test() : node_(iox2::NodeBuilder().create<iox2::ServiceType::Ipc>().expect("successful node creation")) { }
+
+    std::unique_ptr<TunnelPublisherPool> create_pool() {
+        const std::string its_name{"UtTunnelPublisherPool" + std::to_string(getpid()) + "_" + std::to_string(next_pool_++)};
+        return std::unique_ptr<TunnelPublisherPool>(
+                new TunnelPublisherPool{node_.service_builder(iox2::ServiceName::create(its_name.c_str()).expect("valid service name"))
+                                                .publish_subscribe<SomeipTunnelPayload>()
+                                                .user_header<SomeipTunnelHeader>()
+                                                .max_publishers(max_thread_ports + 1)
+                                                .create()
+                                                .expect("successful service creation"),
+                                        node_.service_builder(iox2::ServiceName::create(its_name.c_str()).expect("valid service name"))
+                                                .event()
+                                                .max_notifiers(max_thread_ports + 1)
+                                                .create()
+                                                .expect("successful service creation"),
+                                        max_thread_ports});
+    }
+
+    // Returns the publisher the calling thread gets from _pool
+    static const TunnelPublisher* publisher_of(TunnelPublisherPool& _pool) {
+        const TunnelPublisher* its_publisher = nullptr;
+        _pool.withPublisher([&](TunnelPublisher& _publisher, const TunnelPublisherPool::Notifier&) { its_publisher = &_publisher; });
+        return its_publisher;
+    }
+
+    iox2::Node<iox2::ServiceType::Ipc> node_;
+    int next_pool_{0};
+};
+}
+
+TEST_F(tunnel_publisher_pool_test, thread_alternating_between_two_pools) {
+    auto its_first = create_pool();
+    auto its_second = create_pool();
+    const auto its_first_publisher = publisher_of(*its_first);
+    const auto its_second_publisher = publisher_of(*its_second);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(publisher_of(*its_first), its_first_publisher);
+        ASSERT_EQ(publisher_of(*its_second), its_second_publisher);
+    }
+
+    // Checks.
+    ASSERT_EQ(its_first->threadPortCount(), 1u);
+    ASSERT_EQ(its_second->threadPortCount(), 1u);
+}
+
+TEST_F(tunnel_publisher_pool_test, thread_alternating_between_more_pools_than_cached) {
+    std::vector<std::unique_ptr<TunnelPublisherPool>> its_pools;
+    std::vector<const TunnelPublisher*> its_publishers;
+    for (int i = 0; i < 8; ++i) {
+        its_pools.push_back(create_pool());
+        its_publishers.push_back(publisher_of(*its_pools.back()));
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        for (size_t j = 0; j < its_pools.size(); ++j) {
+            ASSERT_EQ(publisher_of(*its_pools[j]), its_publishers[j]);
+        }
+    }
+
+    // Checks.
+    for (const auto& its_pool : its_pools) {
+        ASSERT_EQ(its_pool->threadPortCount(), 1u);
+    }
+}
+
+TEST_F(tunnel_publisher_pool_test, threads_get_own_ports) {
+    auto its_pool = create_pool();
+    const auto its_publisher = publisher_of(*its_pool);
+
+    const TunnelPublisher* its_other_publisher = nullptr;
+    std::thread its_thread{[&] { its_other_publisher = publisher_of(*its_pool); }};
+    its_thread.join();
+
+    // Checks.
+    ASSERT_NE(its_other_publisher, its_publisher);
+    ASSERT_EQ(its_pool->threadPortCount(), 2u);
+}
+
+TEST_F(tunnel_publisher_pool_test, threads_beyond_limit_share_ports) {
+    auto its_pool = create_pool();
+
+    // The threads stay alive until all published, a thread id may be reused after a join
+    std::vector<const TunnelPublisher*> its_publishers(max_thread_ports + 2);
+    std::atomic<size_t> its_published{0};
+    std::vector<std::thread> its_threads;
+    for (size_t i = 0; i < its_publishers.size(); ++i) {
+        its_threads.emplace_back([&, i] {
+            its_publishers[i] = publisher_of(*its_pool);
+            its_published++;
+            while (its_published < its_publishers.size()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& its_thread : its_threads) {
+        its_thread.join();
+    }
+
+    // Checks.
+    ASSERT_EQ(its_pool->threadPortCount(), max_thread_ports);
+    ASSERT_EQ(std::set<const TunnelPublisher*>(its_publishers.begin(), its_publishers.end()).size(), max_thread_ports + 1);
+}
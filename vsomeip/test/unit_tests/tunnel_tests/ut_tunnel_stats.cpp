@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "tunnel_stats.hpp"
+
+TEST(latency_histogram_test, small_values_have_own_buckets) {
+    // Checks.
+    for (uint64_t i = 0; i < (uint64_t(1) << LatencyHistogram::SUB_BUCKET_BITS); i++) {
+        ASSERT_EQ(LatencyHistogram::bucketOf(i), i);
+        ASSERT_EQ(LatencyHistogram::upperBoundOf(i), i);
+    }
+}
+
+TEST(latency_histogram_test, bucket_boundaries) {
+    // Checks.
+    ASSERT_EQ(LatencyHistogram::bucketOf(16), 16u);
+    ASSERT_EQ(LatencyHistogram::bucketOf(31), 31u);
+    ASSERT_EQ(LatencyHistogram::bucketOf(32), 32u);
+    ASSERT_EQ(LatencyHistogram::bucketOf(33), 32u);
+    ASSERT_EQ(LatencyHistogram::bucketOf(34), 33u);
+    ASSERT_EQ(LatencyHistogram::upperBoundOf(32), 33u);
+    ASSERT_EQ(LatencyHistogram::upperBoundOf(48), 67u);
+
+    // Every bucket ends right before the next one starts
+    for (size_t i = 0; i + 1 < LatencyHistogram::BUCKETS; i++) {
+        const auto its_bound = LatencyHistogram::upperBoundOf(i);
+        ASSERT_EQ(LatencyHistogram::bucketOf(its_bound), i);
+        ASSERT_EQ(LatencyHistogram::bucketOf(its_bound + 1), i + 1);
+    }
+}
+
+TEST(latency_histogram_test, relative_error_is_bounded) {
+    // Checks.
+    for (uint64_t i = 1; i < (uint64_t(1) << LatencyHistogram::MAX_EXPONENT); i = i * 3 + 1) {
+        const auto its_bound = LatencyHistogram::upperBoundOf(LatencyHistogram::bucketOf(i));
+        ASSERT_GE(its_bound, i);
+        ASSERT_LT(its_bound - i, (i >> LatencyHistogram::SUB_BUCKET_BITS) + 1);
+    }
+}
+
+TEST(latency_histogram_test, large_values_go_to_last_bucket) {
+    // Checks.
+    ASSERT_EQ(LatencyHistogram::bucketOf(uint64_t(1) << LatencyHistogram::MAX_EXPONENT), LatencyHistogram::BUCKETS - 1);
+    ASSERT_EQ(LatencyHistogram::bucketOf(UINT64_MAX), LatencyHistogram::BUCKETS - 1);
+    ASSERT_EQ(LatencyHistogram::bucketOf((uint64_t(1) << LatencyHistogram::MAX_EXPONENT) - 1), LatencyHistogram::BUCKETS - 1);
+}
+
+TEST(latency_histogram_test, summarize_empty) {
+    LatencyHistogram its_histogram;
+
+    const auto its_summary = its_histogram.summarize();
+
+    // Checks.
+    ASSERT_EQ(its_summary.count, 0u);
+    ASSERT_EQ(its_summary.p50_ns, 0u);
+    ASSERT_EQ(its_summary.p999_ns, 0u);
+    ASSERT_EQ(its_summary.max_ns, 0u);
+}
+
+TEST(latency_histogram_test, summarize_percentiles) {
+    LatencyHistogram its_histogram;
+    for (int i = 1; i <= 100; i++) {
+        its_histogram.record(std::chrono::nanoseconds(i));
+    }
+
+    const auto its_summary = its_histogram.summarize();
+
+    // Checks.
+    ASSERT_EQ(its_summary.count, 100u);
+    ASSERT_EQ(its_summary.p50_ns, 51u); // bucket 50..51
+    ASSERT_EQ(its_summary.p90_ns, 91u); // bucket 88..91
+    ASSERT_EQ(its_summary.p99_ns, 99u); // bucket 96..99
+    ASSERT_EQ(its_summary.p999_ns, 100u); // bucket 100..103, limited by the maximum
+    ASSERT_EQ(its_summary.max_ns, 100u);
+}
+
+TEST(latency_histogram_test, negative_latency_counts_as_zero) {
+    LatencyHistogram its_histogram;
+    its_histogram.record(std::chrono::nanoseconds(-5));
+
+    const auto its_summary = its_histogram.summarize();
+
+    // Checks.
+    ASSERT_EQ(its_summary.count, 1u);
+    ASSERT_EQ(its_summary.p50_ns, 0u);
+    ASSERT_EQ(its_summary.max_ns, 0u);
+}
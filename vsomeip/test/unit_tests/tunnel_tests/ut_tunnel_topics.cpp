@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "tunnel_topics.hpp"
+
+namespace {
+const vsomeip_v3::service_t service = 0x1234;
+const vsomeip_v3::instance_t instance = 0x0001;
+
+TunnelTopicConfig event_topic(const std::string& _name, vsomeip_v3::event_t _event) {
+    TunnelTopicConfig its_topic;
+    its_topic.name = _name + std::to_string(getpid());
+    its_topic.service = service;
+    its_topic.instance = instance;
+    its_topic.event = _event;
+    return its_topic;
+}
+
+TunnelTopicConfig eventgroup_topic(const std::string& _name, vsomeip_v3::eventgroup_t _eventgroup) {
+    TunnelTopicConfig its_topic;
+    its_topic.name = _name + std::to_string(getpid());
+    its_topic.service = service;
+    its_topic.instance = instance;
+    its_topic.eventgroup = _eventgroup;
+    return its_topic;
+}
+
+vsomeip_v3::event_registration_t event_of(vsomeip_v3::event_t _event, const std::set<vsomeip_v3::eventgroup_t>& _eventgroups) {
+    return vsomeip_v3::event_registration_t(_event, _eventgroups);
+}
+}
+
+TEST(tunnel_topics_test, event_topic_is_found) {
+    const std::vector<TunnelTopicConfig> its_topics{event_topic("UtTopicA", 0x8001), event_topic("UtTopicB", 0x8002)};
+
+    // Checks.
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8001, {0x0001})), 0u);
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8002, {0x0001})), 1u);
+}
+
+TEST(tunnel_topics_test, eventgroup_topic_is_found) {
+    const std::vector<TunnelTopicConfig> its_topics{eventgroup_topic("UtTopicA", 0x0001), eventgroup_topic("UtTopicB", 0x0002)};
+
+    // Checks.
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8001, {0x0002})), 1u);
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8001, {0x0003, 0x0001})), 0u);
+}
+
+TEST(tunnel_topics_test, event_topic_precedes_eventgroup_topic) {
+    const std::vector<TunnelTopicConfig> its_topics{eventgroup_topic("UtTopicA", 0x0001), event_topic("UtTopicB", 0x8001)};
+
+    // Checks.
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8001, {0x0001})), 1u);
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8002, {0x0001})), 0u);
+}
+
+TEST(tunnel_topics_test, unbound_events_use_event_lane) {
+    const std::vector<TunnelTopicConfig> its_topics{event_topic("UtTopicA", 0x8001), eventgroup_topic("UtTopicB", 0x0001)};
+
+    // Checks.
+    ASSERT_EQ(topicOf({}, service, instance, event_of(0x8001, {0x0001})), 0u);
+    ASSERT_EQ(topicOf(its_topics, service, instance, event_of(0x8002, {0x0002})), its_topics.size());
+    ASSERT_EQ(topicOf(its_topics, service + 1, instance, event_of(0x8001, {0x0001})), its_topics.size());
+    ASSERT_EQ(topicOf(its_topics, service, instance + 1, event_of(0x8001, {0x0001})), its_topics.size());
+}
+
+TEST(tunnel_topics_test, assign_find_release) {
+    TunnelConfig its_config;
+    its_config.max_thread_publishers = 1;
+    its_config.topics = {event_topic("UtTopicsA", 0x8001), eventgroup_topic("UtTopicsB", 0x0001)};
+    TunnelStats its_stats;
+    TunnelTopics its_topics(its_config, its_stats);
+    ASSERT_EQ(its_topics.size(), 2u);
+
+    its_topics.assign(service, instance, event_of(0x8001, {0x0001}));
+    its_topics.assign(service, instance, event_of(0x8002, {0x0001}));
+    its_topics.assign(service, instance, event_of(0x8003, {0x0002}));
+
+    // Checks.
+    auto its_event_topic = its_topics.find(service, instance, 0x8001);
+    auto its_eventgroup_topic = its_topics.find(service, instance, 0x8002);
+    ASSERT_NE(its_event_topic, nullptr);
+    ASSERT_NE(its_eventgroup_topic, nullptr);
+    ASSERT_NE(its_event_topic, its_eventgroup_topic);
+    ASSERT_EQ(its_topics.find(service, instance, 0x8003), nullptr);
+
+    its_topics.release(service, instance, 0x8001);
+    ASSERT_EQ(its_topics.find(service, instance, 0x8001), nullptr);
+    ASSERT_EQ(its_topics.find(service, instance, 0x8002), its_eventgroup_topic);
+}